@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file CommandStats.cpp
+///
+/// \brief Call count and execution time statistics per G/M command.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "CommandStats.h"
+
+#include "Marlin.h"
+
+// Commands worth watching: motion, homing and levelling, and everything that
+// can block loop() waiting for heaters, moves or the user.
+static const CommandKey command_table[] PROGMEM =
+{
+	{ 'G', 0 },
+	{ 'G', 1 },
+	{ 'G', 2 },
+	{ 'G', 3 },
+	{ 'G', 4 },
+	{ 'G', 28 },
+	{ 'G', 29 },
+	{ 'G', 92 },
+	{ 'M', 23 },
+	{ 'M', 24 },
+	{ 'M', 25 },
+	{ 'M', 84 },
+	{ 'M', 104 },
+	{ 'M', 105 },
+	{ 'M', 106 },
+	{ 'M', 107 },
+	{ 'M', 109 },
+	{ 'M', 114 },
+	{ 'M', 190 },
+	{ 'M', 400 },
+	{ 'M', 600 },
+	{ 'M', 700 },
+	{ 'M', 800 },
+	{ 'M', 801 },
+};
+
+static_assert(sizeof(command_table) / sizeof(command_table[0]) == CommandStats::tracked_commands,
+	"CommandStats::tracked_commands does not match command_table");
+
+CommandStats::CommandStats()
+{
+	reset();
+}
+
+uint8_t CommandStats::lookup(const char * command)
+{
+	// Lines from a print host start with their number, "N123 G1 ..."
+	if (command[0] == 'N')
+	{
+		command++;
+		while (*command >= '0' && *command <= '9')
+		{
+			command++;
+		}
+	}
+	while (*command == ' ')
+	{
+		command++;
+	}
+
+	char letter = command[0];
+	if (letter != 'G' && letter != 'M')
+	{
+		return other_command;
+	}
+
+	uint16_t number = strtol(command + 1, NULL, 10);
+
+	for (uint8_t i = 0; i < tracked_commands; i++)
+	{
+		if (pgm_read_byte(&command_table[i].letter) == letter &&
+		    pgm_read_word(&command_table[i].number) == number)
+		{
+			return i;
+		}
+	}
+	return other_command;
+}
+
+void CommandStats::record(uint8_t index, uint32_t duration_us)
+{
+	Entry & entry = m_entries[index];
+
+	// Halve count and total instead of overflowing: the average is kept and
+	// recent commands weigh a bit more than old ones.
+	if (entry.count == 0xFFFF || entry.total_us > 0xFFFFFFFFUL - duration_us)
+	{
+		entry.count >>= 1;
+		entry.total_us >>= 1;
+	}
+
+	entry.count++;
+	entry.total_us += duration_us;
+	if (duration_us > entry.max_us)
+	{
+		entry.max_us = duration_us;
+	}
+}
+
+void CommandStats::report()
+{
+	for (uint8_t i = 0; i <= ui_entry; i++)
+	{
+		Entry const & entry = m_entries[i];
+		if (entry.count == 0)
+		{
+			continue;
+		}
+
+		SERIAL_ECHO_START;
+		if (i == other_command)
+		{
+			SERIAL_ECHOPGM("other");
+		}
+		else if (i == loop_entry)
+		{
+			SERIAL_ECHOPGM("loop");
+		}
+		else if (i == ui_entry)
+		{
+			SERIAL_ECHOPGM("ui");
+		}
+		else
+		{
+			SERIAL_ECHO((char) pgm_read_byte(&command_table[i].letter));
+			SERIAL_ECHO((unsigned int) pgm_read_word(&command_table[i].number));
+		}
+		SERIAL_ECHOPGM(" n:");
+		SERIAL_ECHO(entry.count);
+		SERIAL_ECHOPGM(" avg:");
+		SERIAL_ECHO(entry.total_us / entry.count);
+		SERIAL_ECHOPGM("us max:");
+		SERIAL_ECHO(entry.max_us);
+		SERIAL_ECHOLNPGM("us");
+	}
+}
+
+void CommandStats::reset()
+{
+	memset(m_entries, 0, sizeof(m_entries));
+}
+
+CommandStats::Sample::Sample(const char * command)
+	: m_index(CommandStats::lookup(command))
+	, m_start(micros())
+{ }
+
+CommandStats::Sample::Sample(uint8_t index)
+	: m_index(index)
+	, m_start(micros())
+{ }
+
+CommandStats::Sample::~Sample()
+{
+	CommandStats::single::instance().record(m_index, micros() - m_start);
+}
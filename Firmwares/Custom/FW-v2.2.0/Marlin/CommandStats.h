@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file CommandStats.h
+///
+/// \brief Call count and execution time statistics per G/M command.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef COMMAND_STATS_H
+#define COMMAND_STATS_H
+
+#include <stdint.h>
+
+#include "Singleton.h"
+
+//! Key of a command with its own counters, stored in the PROGMEM table of
+//! CommandStats.cpp.
+struct CommandKey
+{
+	char letter;
+	uint16_t number;
+};
+
+class CommandStats
+{
+	public:
+		typedef Singleton<CommandStats> single;
+
+		// Rows in the PROGMEM command table. Any other command is added to one
+		// extra "other" entry, so RAM use stays fixed.
+		static const uint8_t tracked_commands = 24;
+		static const uint8_t other_command = tracked_commands;
+		// Whole passes of loop() and the display update in them
+		static const uint8_t loop_entry = tracked_commands + 1;
+		static const uint8_t ui_entry = tracked_commands + 2;
+
+		struct Entry
+		{
+			uint16_t count;
+			uint32_t total_us;
+			uint32_t max_us;
+		};
+
+		//! \brief Times one command from construction to destruction, so
+		//! every return path of process_commands() is accounted for.
+		class Sample
+		{
+			public:
+				Sample(const char * command);
+				Sample(uint8_t index);
+				~Sample();
+
+			private:
+				uint8_t m_index;
+				unsigned long m_start;
+		};
+
+	public:
+		CommandStats();
+
+		void record(uint8_t index, uint32_t duration_us);
+		void report();
+		void reset();
+
+		static uint8_t lookup(const char * command);
+
+	private:
+		Entry m_entries[tracked_commands + 3];
+};
+
+#endif //COMMAND_STATS_H
@@ -52,7 +52,7 @@ bool raised = false;
 extern bool home_all_axis;
 extern bool bed_leveling;
 extern const char axis_codes[NUM_AXIS];
-extern bool cancel_heatup;
+extern volatile bool cancel_heatup;
 extern bool stop_planner_buffer;
 extern bool planner_buffer_stopped;
 extern bool stop_buffer;
@@ -88,158 +88,192 @@ void action_cooldown()
 	temp::TemperatureManager::single::instance().setTargetTemperature(0);
 }
 
-void action_filament_unload()
+// Action being stepped from loop(), see gui_action_update()
+static ActionStep action_pending = NULL;
+static uint8_t action_pending_step = 0;
+
+//! Runs all the steps of an action, waiting for the moves of each one.
+static void action_run(ActionStep steps)
 {
-	st_synchronize();
+	uint8_t step = 0;
 
-	current_position[E_AXIS] += 50.0;
-	plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS],current_position[E_AXIS], 5, active_extruder);
-	st_synchronize();
+	do
+	{
+		st_synchronize();
+		step = steps(step);
+	} while (step != action_done);
 
-	current_position[E_AXIS] -= 60.0;
-	plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS],current_position[E_AXIS], 5, active_extruder);
 	st_synchronize();
 }
 
-void action_filament_load()
+//! Starts an action that goes on from loop(), so the display, the buttons
+//! and the host are still served while the printer moves.
+static void gui_action_start(ActionStep steps)
 {
-	st_synchronize();
-
-	current_position[E_AXIS] += 140.0;
-	plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS],current_position[E_AXIS], 5, active_extruder);
-	st_synchronize();
+	// One at a time, the one before finishes first
+	while (action_pending != NULL)
+	{
+		st_synchronize();
+		gui_action_update();
+	}
 
-	current_position[E_AXIS] -= RETRACT_ON_PAUSE;
-	plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS], current_position[E_AXIS], max_feedrate[E_AXIS], active_extruder);
-	st_synchronize();
+	action_pending = steps;
+	action_pending_step = 0;
+	gui_action_update();
 }
 
-uint8_t level_plate_step = 0;
+//! Runs the next step of the pending action once the moves of the step
+//! before are done.
+void gui_action_update()
+{
+	while (action_pending != NULL && !blocks_queued())
+	{
+		if (action_pending_step == action_done)
+		{
+			action_pending = NULL;
+			break;
+		}
+		action_pending_step = action_pending(action_pending_step);
+	}
+}
 
-void action_level_plate()
+//! True until the last moves of the action started from the UI are done.
+bool gui_action_busy()
 {
-	#ifndef ABL_MANUAL_PT_4_X
-		uint8_t max_steps = 4;
-		uint8_t order[4] = {0,1,2,4};
-	#else
-		uint8_t max_steps = 5;
-		uint8_t order[5] = {0,1,2,3,4};
-	#endif
+	return (action_pending != NULL);
+}
 
-	switch (order[level_plate_step])
+static uint8_t filament_unload_steps(uint8_t step)
+{
+	switch (step)
 	{
 		case 0:
-			lcd_disable_button();
-
-			target[X_AXIS] = plan_get_axis_position(X_AXIS);
-			target[Y_AXIS] = plan_get_axis_position(Y_AXIS);
-			target[Z_AXIS] = plan_get_axis_position(Z_AXIS);
-			target[E_AXIS] = plan_get_axis_position(E_AXIS);
+			current_position[E_AXIS] += 50.0;
+			plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS],current_position[E_AXIS], 5, active_extruder);
+			return 1;
+
+		default:
+			current_position[E_AXIS] -= 60.0;
+			plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS],current_position[E_AXIS], 5, active_extruder);
+			return action_done;
+	}
+}
 
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
+static uint8_t filament_load_steps(uint8_t step)
+{
+	switch (step)
+	{
+		case 0:
+			current_position[E_AXIS] += 140.0;
+			plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS],current_position[E_AXIS], 5, active_extruder);
+			return 1;
+
+		default:
+			current_position[E_AXIS] -= RETRACT_ON_PAUSE;
+			plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS], current_position[E_AXIS], max_feedrate[E_AXIS], active_extruder);
+			return action_done;
+	}
+}
 
-			target[Z_AXIS] = 10;
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
+void action_filament_unload()
+{
+	action_run(filament_unload_steps);
+}
 
-			target[X_AXIS] = ABL_MANUAL_PT_1_X;
-			target[Y_AXIS] = ABL_MANUAL_PT_1_Y;
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
+void gui_action_filament_unload()
+{
+	gui_action_start(filament_unload_steps);
+}
 
-			target[Z_AXIS] = 0 + OffsetManager::single::instance().offset();
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
-			st_synchronize();
+void action_filament_load()
+{
+	action_run(filament_load_steps);
+}
 
-			lcd_enable_button();
+void gui_action_filament_load()
+{
+	gui_action_start(filament_load_steps);
+}
 
-			break;
+uint8_t level_plate_step = 0;
 
-		case 1:
-			lcd_disable_button();
+static void level_plate_move_to(float x, float y)
+{
+	target[X_AXIS] = plan_get_axis_position(X_AXIS);
+	target[Y_AXIS] = plan_get_axis_position(Y_AXIS);
+	target[Z_AXIS] = plan_get_axis_position(Z_AXIS);
+	target[E_AXIS] = plan_get_axis_position(E_AXIS);
 
-			target[X_AXIS] = plan_get_axis_position(X_AXIS);
-			target[Y_AXIS] = plan_get_axis_position(Y_AXIS);
-			target[Z_AXIS] = plan_get_axis_position(Z_AXIS);
-			target[E_AXIS] = plan_get_axis_position(E_AXIS);
+	plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
 
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
+	target[Z_AXIS] = 10;
+	plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
 
-			target[Z_AXIS] = 10;
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
+	target[X_AXIS] = x;
+	target[Y_AXIS] = y;
+	plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
 
-			target[X_AXIS] = ABL_MANUAL_PT_2_X;
-			target[Y_AXIS] = ABL_MANUAL_PT_2_Y;
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
+	target[Z_AXIS] = 0 + OffsetManager::single::instance().offset();
+	plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
+}
 
-			target[Z_AXIS] = 0 + OffsetManager::single::instance().offset();
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
-			st_synchronize();
+//! Plans the moves to the next point of the plate.
+static void level_plate_moves()
+{
+	#ifndef ABL_MANUAL_PT_4_X
+		uint8_t max_steps = 4;
+		uint8_t order[4] = {0,1,2,4};
+	#else
+		uint8_t max_steps = 5;
+		uint8_t order[5] = {0,1,2,3,4};
+	#endif
 
-			lcd_enable_button();
+	switch (order[level_plate_step])
+	{
+		case 0:
+			level_plate_move_to(ABL_MANUAL_PT_1_X, ABL_MANUAL_PT_1_Y);
+			break;
 
+		case 1:
+			level_plate_move_to(ABL_MANUAL_PT_2_X, ABL_MANUAL_PT_2_Y);
 			break;
 
 		case 2:
-			lcd_disable_button();
-
-			target[X_AXIS] = plan_get_axis_position(X_AXIS);
-			target[Y_AXIS] = plan_get_axis_position(Y_AXIS);
-			target[Z_AXIS] = plan_get_axis_position(Z_AXIS);
-			target[E_AXIS] = plan_get_axis_position(E_AXIS);
-
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
-
-			target[Z_AXIS] = 10;
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
-
-			target[X_AXIS] = ABL_MANUAL_PT_3_X;
-			target[Y_AXIS] = ABL_MANUAL_PT_3_Y;
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
-
-			target[Z_AXIS] = 0 + OffsetManager::single::instance().offset();
-			plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
-			st_synchronize();
-
-			lcd_enable_button();
-
+			level_plate_move_to(ABL_MANUAL_PT_3_X, ABL_MANUAL_PT_3_Y);
 			break;
 
 		case 3:
 			#ifdef ABL_MANUAL_PT_4_X
-				lcd_disable_button();
-
-				target[X_AXIS] = plan_get_axis_position(X_AXIS);
-				target[Y_AXIS] = plan_get_axis_position(Y_AXIS);
-				target[Z_AXIS] = plan_get_axis_position(Z_AXIS);
-				target[E_AXIS] = plan_get_axis_position(E_AXIS);
-
-				plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
-
-				target[Z_AXIS] = 10;
-				plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
-
-				target[X_AXIS] = ABL_MANUAL_PT_4_X;
-				target[Y_AXIS] = ABL_MANUAL_PT_4_Y;
-				plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
-
-				target[Z_AXIS] = 0 + OffsetManager::single::instance().offset();;
-				plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], manual_feedrate[X_AXIS] / 60, active_extruder);
-				st_synchronize();
-
-				lcd_enable_button();
+				level_plate_move_to(ABL_MANUAL_PT_4_X, ABL_MANUAL_PT_4_Y);
 			#endif // ABL_MANUAL_PT_4_X
-
 			break;
 
 		case 4:
-			lcd_disable_button();
-			lcd_enable_button();
-
 			break;
 	}
 
 	level_plate_step = ++level_plate_step % max_steps;
 }
 
+static uint8_t level_plate_steps(uint8_t step)
+{
+	level_plate_moves();
+	return action_done;
+}
+
+void action_level_plate()
+{
+	lcd_disable_button();
+	level_plate_moves();
+	st_synchronize();
+	lcd_enable_button();
+}
+
+void gui_action_level_plate()
+{
+	gui_action_start(level_plate_steps);
+}
+
 void gui_action_homing()
 {
 	action_homing();
@@ -590,27 +624,41 @@ void action_move_to_rest()
 	current_position[Z_AXIS] = update_position_3.z;
 }
 
-void action_move_to_filament_change()
+static uint8_t move_to_filament_change_steps(uint8_t step)
 {
-	st_synchronize();
+	switch (step)
+	{
+		case 0:
+		{
+			vector_3 update_position = plan_get_position();
+			current_position[X_AXIS] = update_position.x;
+			current_position[Y_AXIS] = update_position.y;
+			current_position[Z_AXIS] = update_position.z;
 
-	vector_3 update_position = plan_get_position();
-	current_position[X_AXIS] = update_position.x;
-	current_position[Y_AXIS] = update_position.y;
-	current_position[Z_AXIS] = update_position.z;
+			if ((change_filament == false) || (current_position[Z_AXIS] < POSITION_FILAMENT_Z))
+			{
+				current_position[Z_AXIS] = POSITION_FILAMENT_Z;
+				plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS],current_position[E_AXIS], 60, active_extruder);
+			}
+			return 1;
+		}
 
-	if ((change_filament == false) || (current_position[Z_AXIS] < POSITION_FILAMENT_Z))
-	{
-		current_position[Z_AXIS] = POSITION_FILAMENT_Z;
-		plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS],current_position[E_AXIS], 60, active_extruder);
-		st_synchronize();
+		default:
+			current_position[X_AXIS] = POSITION_FILAMENT_X;
+			current_position[Y_AXIS] = POSITION_FILAMENT_Y;
+			plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS],current_position[E_AXIS], 100, active_extruder);
+			return action_done;
 	}
+}
 
-	current_position[X_AXIS] = POSITION_FILAMENT_X;
-	current_position[Y_AXIS] = POSITION_FILAMENT_Y;
-	plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS],current_position[E_AXIS], 100, active_extruder);
+void action_move_to_filament_change()
+{
+	action_run(move_to_filament_change_steps);
+}
 
-	st_synchronize();
+void gui_action_move_to_filament_change()
+{
+	gui_action_start(move_to_filament_change_steps);
 }
 
 float action_get_height()
@@ -32,15 +32,27 @@
 
 #include "Action.h"
 
+//! A UI action split at the points where it waits for the printer: each
+//! step plans some moves and returns the step to run once they are done,
+//! or action_done after the last one.
+typedef uint8_t (*ActionStep)(uint8_t step);
+const uint8_t action_done = 0xFF;
+
+extern void gui_action_update();
+extern bool gui_action_busy();
+
 extern void action_set_temperature(uint16_t degrees);
 extern void action_preheat();
 extern void action_cooldown();
 
 extern void action_filament_unload();
 extern void action_filament_load();
+extern void gui_action_filament_unload();
+extern void gui_action_filament_load();
 
 extern uint8_t level_plate_step;
 extern void action_level_plate();
+extern void gui_action_level_plate();
 
 extern void gui_action_homing();
 extern void gui_action_z_homing();
@@ -50,6 +62,7 @@ extern void action_correct_movement(float &x_pos, float &y_pos, float &z_pos);
 extern void action_move_axis_to(uint8_t axis, float position);
 extern void action_move_to_rest();
 extern void action_move_to_filament_change();
+extern void gui_action_move_to_filament_change();
 extern float action_get_height();
 
 extern void action_start_print();
@@ -29,6 +29,7 @@
 
 #include "Marlin.h"
 #include "cardreader.h"
+#include "planner.h"
 #include "ConfigurationStore.h"
 #include "temperature.h"
 #include "Serial.h"
@@ -46,6 +47,14 @@
 #include "ViewManager.h"
 #include "PrintManager.h"
 
+#ifdef GUI_BENCHMARK
+	#include "ViewPool.h"
+	#include "SdFatUtil.h"
+	#ifdef HOST_BUILD
+		#include "Host.h"
+	#endif // HOST_BUILD
+#endif // GUI_BENCHMARK
+
 #include <avr/wdt.h>
 
 /////////////////////////////////////////////////////////////////////////
@@ -77,6 +86,16 @@ int absPreheatFanSpeed;
 #define encrot3 1
 #  endif // ( defined(EN_A) && defined(EN_B) )
 
+// Timer 5 runs at 64 us per count (16 MHz / 1024)
+#define LCD_TIMER_US 64
+#define LCD_MS_TO_TICKS(ms) ((uint32_t)(ms) * 1000 / LCD_TIMER_US)
+
+// Input sampling, encoder on every tick and button on every tenth
+#define LCD_INPUT_TICK 16
+#define LCD_BUTTON_TICKS 10
+
+#define LCD_BEEP_FEEDBACK_TICKS 195  // 12.5 ms
+
 /*******************************************************************************
 **   Variables
 *******************************************************************************/
@@ -115,11 +134,14 @@ bool    button_input_updated;
 
 bool    button_clicked_triggered;
 
-// Beeper related variables
-uint32_t beeper_duration = 0;
+// Button sample of the previous input tick, for the debounce
+uint8_t button_sample;
+
+// Beeper related variables, the time left once the running compare fires
+uint32_t beeper_ticks = 0;
 
 // ISR related variables
-uint16_t lcd_timer = 0;
+uint8_t lcd_input_ticks = 0;
 
 // Status screen drawer variables
 uint8_t lcd_status_message_level;
@@ -149,12 +171,44 @@ uint8_t lcd_implementation_update_buttons()
   return buttons_vector;
 }
 
-static void lcd_implementation_quick_feedback()
+// Runs the next stretch of the beep on compare B of Timer 5, or ends it.
+// Called with the interrupts disabled.
+static void lcd_beeper_schedule()
 {
 #if ( defined(BEEPER) && (BEEPER > 0) )
-   SET_OUTPUT(BEEPER);
-   beeper_duration = 100;
-#endif
+    if (beeper_ticks == 0) {
+        WRITE(BEEPER, LOW);
+        TIMSK5 &= ~_BV(OCIE5B);
+        return;
+    }
+
+    // Stay well inside one turn of the counter
+    uint16_t stretch = (beeper_ticks > 0x8000) ? 0x8000 : beeper_ticks;
+    beeper_ticks -= stretch;
+
+    WRITE(BEEPER, HIGH);
+    OCR5B = TCNT5 + stretch;
+    TIFR5 = _BV(OCF5B);
+    TIMSK5 |= _BV(OCIE5B);
+#endif // ( defined(BEEPER) && (BEEPER > 0) )
+}
+
+static void lcd_beeper_start(uint32_t ticks)
+{
+#if ( defined(BEEPER) && (BEEPER > 0) )
+    SET_OUTPUT(BEEPER);
+
+    uint8_t sreg = SREG;
+    cli();
+    beeper_ticks = ticks;
+    lcd_beeper_schedule();
+    SREG = sreg;
+#endif // ( defined(BEEPER) && (BEEPER > 0) )
+}
+
+static void lcd_implementation_quick_feedback()
+{
+    lcd_beeper_start(LCD_BEEP_FEEDBACK_TICKS);
 }
 void lcd_init()
 {
@@ -180,12 +234,10 @@ void lcd_init()
 	digitalWrite(43, HIGH);
 
 
-	// Init Timer 5 and set the OVF interrupt (triggered every 125 us)
-	TCCR5A = 0x03;
-	TCCR5B = 0x19;
-
-	OCR5AH = 0x07;
-	OCR5AL = 0xD0;
+	// Init Timer 5 free running at 64 us per count. Compare A samples the
+	// encoder and the button, compare B ends the beeps.
+	TCCR5A = 0x00;
+	TCCR5B = _BV(CS52) | _BV(CS50);
 
 	lcd_enable_interrupt();
 
@@ -203,7 +255,7 @@ void lcd_init()
 	lcd_get_button_clicked();
 
 	ui::ViewManager::getInstance().activeView(ui::screen_splash);
-	ui::ViewManager::getInstance().activeView()->draw();
+	ui::ViewManager::getInstance().draw();
 
 	SERIAL_ECHOLN("LCD initialized!");
 }
@@ -214,8 +266,15 @@ static void lcd_update_button()
 {
     static uint16_t button_pressed_count = 0;
 
-    // Read the hardware
-    button_input = lcd_implementation_update_buttons();
+    // Read the hardware, a change of the button only counts once two samples
+    // in a row agree
+    uint8_t sample = lcd_implementation_update_buttons();
+    if ((sample ^ button_sample) & EN_C) {
+        button_sample = sample;
+        return;
+    }
+    button_sample = sample;
+    button_input = sample;
 
     // Process button click/keep-press events
     bool button_clicked = ((button_input & EN_C) && (~(button_input_last) & EN_C));
@@ -329,6 +388,41 @@ static void lcd_update_encoder()
     encoder_input_last = encoder_input;
 }
 
+// Earliest time of the next refresh of the display without any input
+static uint32_t lcd_next_refresh_ms = 0;
+
+//! True if the display is due for a refresh. Input and new views don't
+//! wait; otherwise the last redraw sets the time of the next one, later
+//! while the planner is running out of moves.
+static bool lcd_refresh_due(bool input)
+{
+    if (ui::ViewManager::getInstance().refreshPending() == true || input == true)
+    {
+        return true;
+    }
+    return (int32_t)(millis() - lcd_next_refresh_ms) >= 0;
+}
+
+static void lcd_schedule_refresh(uint32_t draw_us)
+{
+    uint32_t interval_ms = GUI_REFRESH_MS;
+
+    // Keep the UI within its share of the main loop
+    uint32_t budget_ms = draw_us / (10 * GUI_LOOP_SHARE);
+    if (budget_ms > interval_ms)
+    {
+        interval_ms = budget_ms;
+    }
+
+    // Moves are running out, commands go first
+    if (planner_priority == true && blocks_queued() == true && interval_ms < GUI_REFRESH_LOW_MS)
+    {
+        interval_ms = GUI_REFRESH_LOW_MS;
+    }
+
+    lcd_next_refresh_ms = millis() + interval_ms;
+}
+
 void lcd_update(bool force)
 {
     SDManager::updateSDStatus();
@@ -338,25 +432,134 @@ void lcd_update(bool force)
         PrintManager::single::instance().updateTime();
     }
 
-    // Manage the events triggered in ISR (Timer 5 Overflow)
+    bool input = false;
+
+    // Manage the events triggered in ISR (Timer 5 Compare A)
     for (int8_t times = lcd_get_encoder_right(); times > 0; times--)
     {
-        ui::ViewManager::getInstance().activeView()->right();
+        ui::ViewManager::getInstance().right();
+        input = true;
     }
 
     for (int8_t times = lcd_get_encoder_left(); times > 0; times--)
     {
-        ui::ViewManager::getInstance().activeView()->left();
+        ui::ViewManager::getInstance().left();
+        input = true;
     }
 
     if (lcd_get_button_clicked())
     {
-        ui::ViewManager::getInstance().activeView()->press();
+        ui::ViewManager::getInstance().press();
+        input = true;
     }
 
     // Refresh the content of the display
-    ui::ViewManager::getInstance().activeView()->draw();
+    if (force == true || lcd_refresh_due(input) == true)
+    {
+        uint32_t start_us = micros();
+        ui::ViewManager::getInstance().draw();
+        lcd_schedule_refresh(micros() - start_us);
+    }
+}
+
+#ifdef GUI_BENCHMARK
+// Drawing takes no virtual time on the host build, so the host's clock
+// times it there.
+#ifdef HOST_BUILD
+	#define lcd_benchmark_micros() host_real_micros()
+#else
+	#define lcd_benchmark_micros() micros()
+#endif // HOST_BUILD
+
+//! Plays a script of encoder and button events on the views, one step per
+//! letter, and redraws the active view after each one as lcd_update() does:
+//!
+//!   L, R  turn the encoder one step left or right
+//!   P     press the button
+//!   D     redraw the active view whole, without any event
+//!
+//! Anything else is skipped. Each step reports the view it ends on, how long
+//! it took to redraw, the bytes sent to the display, the part of the view
+//! pool in use and the free RAM.
+//!
+//! With HOST_BUILD the heap in use stands for the free RAM, and the frame
+//! of each step is written as a PBM image when --frames names a folder.
+void lcd_benchmark(const char * script)
+{
+	uint16_t steps = 0;
+	uint32_t total_us = 0;
+	uint32_t max_us = 0;
+	uint32_t start_bytes = u8g_dev_st7920_128x64_rrd_total_bytes;
+
+	for ( ; *script != '\0'; script++)
+	{
+		switch (*script)
+		{
+			case 'L':
+				ui::ViewManager::getInstance().left();
+				break;
+			case 'R':
+				ui::ViewManager::getInstance().right();
+				break;
+			case 'P':
+				ui::ViewManager::getInstance().press();
+				break;
+			case 'D':
+				ui::ViewManager::getInstance().activeView()->m_needs_drawing = true;
+				break;
+			default:
+				continue;
+		}
+
+		uint32_t bytes = u8g_dev_st7920_128x64_rrd_total_bytes;
+		uint32_t start_us = lcd_benchmark_micros();
+		ui::ViewManager::getInstance().draw();
+		uint32_t draw_us = lcd_benchmark_micros() - start_us;
+		bytes = u8g_dev_st7920_128x64_rrd_total_bytes - bytes;
+
+		total_us += draw_us;
+		if (draw_us > max_us)
+		{
+			max_us = draw_us;
+		}
+
+		SERIAL_ECHO_START;
+		SERIAL_ECHOPGM("UI ");
+		SERIAL_ECHO(*script);
+		SERIAL_ECHOPGM(" screen:");
+		SERIAL_ECHO((int) ui::ViewManager::getInstance().getViewIndex());
+		SERIAL_ECHOPGM(" draw:");
+		SERIAL_ECHO(draw_us);
+		SERIAL_ECHOPGM("us bytes:");
+		SERIAL_ECHO(bytes);
+		SERIAL_ECHOPGM(" pool:");
+		SERIAL_ECHO(ui::ViewPool::used());
+		SERIAL_ECHO('/');
+		SERIAL_ECHO(ui::ViewPool::size());
+#ifdef HOST_BUILD
+		SERIAL_ECHOPGM(" heap:");
+		SERIAL_ECHOLN(host_heap_used());
+
+		host_display_dump(steps);
+#else
+		SERIAL_ECHOPGM(" free:");
+		SERIAL_ECHOLN(SdFatUtil::FreeRam());
+#endif // HOST_BUILD
+
+		steps++;
+	}
+
+	SERIAL_ECHO_START;
+	SERIAL_ECHOPGM("UI steps:");
+	SERIAL_ECHO(steps);
+	SERIAL_ECHOPGM(" avg:");
+	SERIAL_ECHO(steps ? total_us / steps : 0);
+	SERIAL_ECHOPGM("us max:");
+	SERIAL_ECHO(max_us);
+	SERIAL_ECHOPGM("us bytes:");
+	SERIAL_ECHOLN(u8g_dev_st7920_128x64_rrd_total_bytes - start_bytes);
 }
+#endif // GUI_BENCHMARK
 
 // Get and clear trigger functions
 bool lcd_get_button_updated()
@@ -401,7 +604,11 @@ void lcd_clear_triggered_flags() {
 
 void lcd_disable_buzzer()
 {
-    beeper_duration = 0;
+    uint8_t sreg = SREG;
+    cli();
+    beeper_ticks = 0;
+    TIMSK5 &= ~_BV(OCIE5B);
+    SREG = sreg;
     WRITE(BEEPER, LOW);
 }
 
@@ -409,6 +616,7 @@ void lcd_disable_buzzer()
 void lcd_enable_button() {
     button_input = lcd_implementation_update_buttons();
     button_input_last = button_input;
+    button_sample = button_input;
     button_input_blocked = false;
 }
 void lcd_disable_button() {
@@ -437,7 +645,12 @@ void lcd_disable_display_timeout()
 
 void lcd_enable_interrupt()
 {
-    TIMSK5 |= 0x01;
+    uint8_t sreg = SREG;
+    cli();
+    OCR5A = TCNT5 + LCD_INPUT_TICK;
+    TIFR5 = _BV(OCF5A);
+    TIMSK5 |= _BV(OCIE5A);
+    SREG = sreg;
     lcd_enable_button();
     lcd_enable_encoder();
 }
@@ -447,7 +660,7 @@ void lcd_disable_interrupt()
     lcd_disable_button();
     lcd_disable_encoder();
     lcd_disable_buzzer();
-    TIMSK5 &= ~(0x01);
+    TIMSK5 &= ~_BV(OCIE5A);
 }
 
 
@@ -467,7 +680,7 @@ void lcd_beep()
 
 void lcd_beep_ms(uint16_t ms)
 {
-    beeper_duration = 8 * ms;
+    lcd_beeper_start(LCD_MS_TO_TICKS(ms));
 }
 
 void lcd_set_refresh(uint8_t mode)
@@ -555,27 +768,20 @@ void lcd_emergency_stop()
 	RESET();
 }
 
-ISR(TIMER5_OVF_vect) // Every 125 us
+ISR(TIMER5_COMPA_vect) // Every LCD_INPUT_TICK, about 1 ms
 {
-    lcd_timer++;
+    OCR5A += LCD_INPUT_TICK;
 
-#if ( defined(BEEPER) && (BEEPER > 0) )
-    if (beeper_duration) {
-        WRITE(BEEPER, HIGH);
-        beeper_duration--;
-    } else {
-        WRITE(BEEPER, LOW);
-    }
-#endif // ( defined(BEEPER) && (BEEPER > 0) )
-
-    if (lcd_timer % 4 == 0)     // Every 500 us
-        lcd_update_encoder();
+    // The quadrature decoding drops a bounce as a step and its way back
+    lcd_update_encoder();
 
-    if (lcd_timer % 80 == 0) {  // Every 10 ms
+    if (++lcd_input_ticks == LCD_BUTTON_TICKS) {  // About every 10 ms
         lcd_update_button();
-        lcd_timer = 0;
+        lcd_input_ticks = 0;
     }
 }
 
-
-
+ISR(TIMER5_COMPB_vect) // End of the beep, or of a stretch of a long one
+{
+    lcd_beeper_schedule();
+}
@@ -42,6 +42,17 @@
 #define LCD_REFRESH_LIMIT          60
 #define LCD_MOVE_RESIDENCY_TIME   500
 
+// Refresh of the display when there is no input, see Configuration_adv.h
+#ifndef GUI_REFRESH_MS
+	#define GUI_REFRESH_MS 50
+#endif // GUI_REFRESH_MS
+#ifndef GUI_REFRESH_LOW_MS
+	#define GUI_REFRESH_LOW_MS 500
+#endif // GUI_REFRESH_LOW_MS
+#ifndef GUI_LOOP_SHARE
+	#define GUI_LOOP_SHARE 20
+#endif // GUI_LOOP_SHARE
+
 #define NO_UPDATE_SCREEN            0
 #define UPDATE_SCREEN               1
 #define CLEAR_AND_UPDATE_SCREEN     2
@@ -64,7 +75,7 @@ extern int absPreheatHotendTemp;
 extern int absPreheatHPBTemp;
 extern int absPreheatFanSpeed;
 
-extern bool cancel_heatup;
+extern volatile bool cancel_heatup;
 // END TODO
 
 //
@@ -82,6 +93,9 @@ uint8_t lcd_get_encoder_right();
 uint8_t lcd_get_encoder_left();
 void lcd_clear_triggered_flags();
 
+// Scripted encoder and button events with the redraw times (M865)
+void lcd_benchmark(const char * script);
+
 // Enable/disable functions
 void lcd_enable_button();
 void lcd_disable_button();
@@ -0,0 +1,241 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file LayerIndex.cpp
+///
+/// \brief Sidecar index of the layers of the selected SD file.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "Marlin.h"
+#include "LayerIndex.h"
+
+#ifdef SD_LAYER_INDEX
+
+#define LAYER_INDEX_MAGIC 0x594C // "LY"
+#define LAYER_INDEX_VERSION 1
+
+LayerIndex::LayerIndex()
+	: m_file_size(0)
+	, m_last_offset(0)
+	, m_count(0)
+	, m_current(0)
+	, m_layer_z(-1)
+	, m_buffered(0)
+	, m_complete(false)
+	, m_recording(false)
+	, m_continuous(false)
+{
+	m_name[0] = '\0';
+}
+
+//! Opens the index of gcode, which is in dir, if there is one and it
+//! still matches the file. Otherwise a new one is created at the first
+//! layer printed.
+void LayerIndex::open(SdBaseFile * dir, SdBaseFile * gcode)
+{
+	Header header;
+
+	close();
+
+	m_dir = *dir;
+	m_file_size = gcode->fileSize();
+	m_recording = true;
+	m_continuous = true;
+
+	gcode->getFilename(m_name);
+	char * extension = strchr(m_name, '.');
+	strcpy(extension ? extension : m_name + strlen(m_name), ".LYR");
+
+	// An index supplied on a write protected card can still be used
+	if (!m_file.open(&m_dir, m_name, O_RDWR) && !m_file.open(&m_dir, m_name, O_READ))
+	{
+		return;
+	}
+
+	if (m_file.read(&header, sizeof(header)) != sizeof(header)
+		|| header.magic != LAYER_INDEX_MAGIC
+		|| header.version != LAYER_INDEX_VERSION
+		|| header.file_size != m_file_size)
+	{
+		// Written for another version of the file
+		m_file.close();
+		return;
+	}
+
+	m_count = (m_file.fileSize() - sizeof(Header)) / sizeof(Layer);
+	m_complete = header.complete;
+
+	Layer last;
+	if (m_count > 0 && getLayer(m_count, last))
+	{
+		m_last_offset = last.offset;
+	}
+}
+
+void LayerIndex::close()
+{
+	flush();
+	if (m_file.isOpen())
+	{
+		m_file.close();
+	}
+	if (m_dir.isOpen())
+	{
+		m_dir.close();
+	}
+
+	m_file_size = 0;
+	m_last_offset = 0;
+	m_count = 0;
+	m_current = 0;
+	m_layer_z = -1;
+	m_buffered = 0;
+	m_complete = false;
+	m_recording = false;
+	m_continuous = false;
+}
+
+//! Called for every move read from the file, before it is planned. start
+//! and end are the positions before and after the move.
+void LayerIndex::record(uint32_t offset, const float * start, const float * end, float feedrate)
+{
+	if (end[E_AXIS] <= start[E_AXIS] || fabs(end[Z_AXIS] - m_layer_z) < LAYER_INDEX_MIN_STEP)
+	{
+		return;
+	}
+
+	m_layer_z = end[Z_AXIS];
+	m_current++;
+
+	// Only layers following the ones already indexed are written
+	if (!m_recording || m_complete || !m_continuous || m_current != m_count + 1
+		|| (m_count > 0 && offset <= m_last_offset))
+	{
+		return;
+	}
+
+	Layer layer = { offset, start[X_AXIS], start[Y_AXIS], end[Z_AXIS], start[E_AXIS], feedrate };
+	m_buffer[m_buffered++] = layer;
+	m_count++;
+	m_last_offset = offset;
+
+	if (m_buffered == LAYER_INDEX_BUFFER)
+	{
+		writeBuffer();
+	}
+}
+
+//! Writes the layers recorded so far and syncs the file. Called when the
+//! print is paused, ends or is closed.
+void LayerIndex::flush()
+{
+	if (writeBuffer() && m_file.isOpen() && m_recording)
+	{
+		if (!m_file.sync())
+		{
+			m_recording = false;
+		}
+	}
+}
+
+bool LayerIndex::writeBuffer()
+{
+	if (!m_recording || m_buffered == 0)
+	{
+		return true;
+	}
+
+	uint16_t length = m_buffered * sizeof(Layer);
+	if ((!m_file.isOpen() && !create())
+		|| !m_file.seekEnd()
+		|| m_file.write(m_buffer, length) != length)
+	{
+		// Read-only or full card, the print goes on without the index
+		m_count -= m_buffered;
+		m_buffered = 0;
+		m_recording = false;
+		return false;
+	}
+
+	m_buffered = 0;
+	return true;
+}
+
+//! Called when the print reaches the end of the file. The index is
+//! complete if the print went through all of it.
+void LayerIndex::finish()
+{
+	Header header = { LAYER_INDEX_MAGIC, LAYER_INDEX_VERSION, 1, m_file_size };
+
+	if (!m_recording || m_complete || !m_continuous || m_current != m_count
+		|| !writeBuffer() || !m_file.isOpen())
+	{
+		flush();
+		return;
+	}
+
+	if (m_file.seekSet(0) && m_file.write(&header, sizeof(header)) == sizeof(header) && m_file.sync())
+	{
+		m_complete = true;
+	}
+}
+
+//! Reads layer number, counted from 1.
+bool LayerIndex::getLayer(uint16_t number, Layer & layer)
+{
+	if (number == 0 || number > m_count)
+	{
+		return false;
+	}
+
+	uint16_t written = m_count - m_buffered;
+	if (number > written)
+	{
+		layer = m_buffer[number - written - 1];
+		return true;
+	}
+
+	if (!m_file.isOpen())
+	{
+		return false;
+	}
+
+	return m_file.seekSet(sizeof(Header) + (uint32_t)(number - 1) * sizeof(Layer))
+		&& m_file.read(&layer, sizeof(layer)) == sizeof(layer);
+}
+
+//! The print goes on from the start of layer number, at height z.
+void LayerIndex::setLayer(uint16_t number, float z)
+{
+	m_current = number - 1;
+	m_layer_z = z - 2 * LAYER_INDEX_MIN_STEP;
+	m_continuous = true;
+}
+
+bool LayerIndex::create()
+{
+	Header header = { LAYER_INDEX_MAGIC, LAYER_INDEX_VERSION, 0, m_file_size };
+
+	if (!m_file.open(&m_dir, m_name, O_RDWR | O_CREAT | O_TRUNC))
+	{
+		return false;
+	}
+
+	return m_file.write(&header, sizeof(header)) == sizeof(header);
+}
+
+#endif //SD_LAYER_INDEX
@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file LayerIndex.h
+///
+/// \brief Sidecar index of the layers of the selected SD file.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef LAYER_INDEX_H
+#define LAYER_INDEX_H
+
+#include "SdFile.h"
+
+#ifdef SD_LAYER_INDEX
+
+// Smallest change of Z between two extruding moves that starts a layer
+#define LAYER_INDEX_MIN_STEP 0.05
+
+// Layers recorded in RAM before they are written to the card
+#ifndef LAYER_INDEX_BUFFER
+	#define LAYER_INDEX_BUFFER 8
+#endif //LAYER_INDEX_BUFFER
+
+//! \brief Keeps, next to a G-code file, the byte offset and the machine
+//! state where each of its layers starts, so a print can be resumed from
+//! any layer.
+//!
+//! The index has the short name of the G-code file with the LYR extension
+//! (PART.GCO -> PART.LYR). It is either written by scripts/layer_index.py
+//! or recorded while the file is printed: a layer starts at each extruding
+//! move whose Z differs from the current layer by LAYER_INDEX_MIN_STEP or
+//! more. Layers are only appended, so an interrupted print leaves an index
+//! of everything it printed. The index is complete once the file has been
+//! printed to the end, and is thrown away if the G-code file changes size.
+//!
+//! Recorded layers are kept in RAM and written LAYER_INDEX_BUFFER at a
+//! time. The file is only synced when the print is paused, ends or is
+//! closed, so there is no FAT update during a print. A power cut loses
+//! what was recorded since the last sync.
+//!
+//! File layout, little endian: a Header followed by one Layer per layer.
+class LayerIndex
+{
+	public:
+		struct Layer
+		{
+			uint32_t offset;  // first byte of the line starting the layer
+			float x;          // position before that line
+			float y;
+			float z;          // height of the layer
+			float e;          // extruder position before that line
+			float feedrate;   // mm/min
+		};
+
+		struct Header
+		{
+			uint16_t magic;
+			uint8_t version;
+			uint8_t complete;
+			uint32_t file_size;  // size of the G-code file it describes
+		};
+
+	public:
+		LayerIndex();
+
+		void open(SdBaseFile * dir, SdBaseFile * gcode);
+		void close();
+		void record(uint32_t offset, const float * start, const float * end, float feedrate);
+		void finish();
+		void flush();
+
+		bool getLayer(uint16_t number, Layer & layer);
+		void setLayer(uint16_t number, float z);
+		inline void jump() { m_continuous = false; };
+
+		inline uint16_t getCount() { return m_count; };
+		inline uint16_t getCurrent() { return m_current; };
+		inline bool isComplete() { return m_complete; };
+
+	private:
+		bool create();
+		bool writeBuffer();
+
+	private:
+		SdBaseFile m_dir;
+		SdBaseFile m_file;
+		char m_name[13];
+		uint32_t m_file_size;
+		uint32_t m_last_offset;
+		uint16_t m_count;
+		uint16_t m_current;
+		float m_layer_z;
+		Layer m_buffer[LAYER_INDEX_BUFFER];
+		uint8_t m_buffered;  // layers of m_buffer not written yet
+		bool m_complete;
+		bool m_recording;   // new layers can be written
+		bool m_continuous;  // printed from the start or from an indexed layer
+};
+
+#endif //SD_LAYER_INDEX
+#endif //LAYER_INDEX_H
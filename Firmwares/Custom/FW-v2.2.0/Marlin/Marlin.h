@@ -236,6 +236,16 @@ void clamp_to_software_endstops(float target[3]);
 
 void refresh_cmd_timeout(void);
 
+void print_heaterstates(uint8_t extruder);
+void print_position();
+void report_status();
+#ifdef REALTIME_COMMANDS
+void manage_realtime_commands();
+#endif
+#ifdef AUTO_REPORT_STATUS
+void manage_auto_report();
+#endif
+
 void set_relative_mode(bool);
 
 #ifdef FAST_PWM_FAN
@@ -247,6 +257,7 @@ void setPwmFrequency(uint8_t pin, int val);
   #define CRITICAL_SECTION_END    SREG = _sreg;
 #endif //CRITICAL_SECTION_START
 
+extern volatile bool cancel_heatup;
 extern bool home_all_axis;
 extern bool allow_home;
 extern const char axis_codes[NUM_AXIS];
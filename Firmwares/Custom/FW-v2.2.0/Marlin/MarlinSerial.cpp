@@ -22,6 +22,7 @@
 
 #include "Marlin.h"
 #include "MarlinSerial.h"
+#include "temperature.h"
 
 #ifndef AT90USB
 // this next line disables the entire HardwareSerial.cpp, 
@@ -30,9 +31,124 @@
 
 #if UART_PRESENT(SERIAL_PORT)
   ring_buffer rx_buffer  =  { { 0 }, 0, 0 };
+  #if TX_BUFFER_SIZE > 0
+    tx_ring_buffer tx_buffer = { { 0 }, 0, 0 };
+  #endif
 #endif
 
-FORCE_INLINE void store_char(unsigned char c) {
+#ifdef REALTIME_COMMANDS
+volatile uint8_t rt_pending = 0;
+volatile int8_t rt_feedrate_delta = 0;
+volatile bool rt_paused = false;
+
+// Recognises "M108" and "M112" at the start of a line, after an optional
+// line number. The text is still stored, so the queue sees the command too.
+enum RealtimeParserState {
+  RT_STATE_RESET,
+  RT_STATE_N,
+  RT_STATE_M,
+  RT_STATE_M1,
+  RT_STATE_M10,
+  RT_STATE_M11,
+  RT_STATE_M108,
+  RT_STATE_M112,
+  RT_STATE_IGNORE
+};
+
+static uint8_t rt_state = RT_STATE_RESET;
+
+// Only switches the heaters and motors off. kill() updates the LCD and
+// waits with interrupts enabled, so it runs later from the main loop or
+// manage_inactivity().
+static void rt_emergency_stop() {
+  disable_heater();
+  disable_x();
+  disable_y();
+  disable_z();
+  disable_e0();
+  disable_e1();
+  disable_e2();
+  rt_pending |= RT_PENDING_KILL;
+}
+
+static FORCE_INLINE void rt_add_feedrate(int8_t delta) {
+  int8_t d = rt_feedrate_delta + delta;
+  rt_feedrate_delta = constrain(d, -100, 100);
+  rt_pending |= RT_PENDING_FEEDRATE;
+}
+
+// Returns true when c is a single byte realtime command and must not be
+// stored in the RX buffer.
+static FORCE_INLINE bool rt_parse(unsigned char c) {
+  switch (c) {
+    case RT_STATUS_REPORT:
+      rt_pending |= RT_PENDING_STATUS;
+      return true;
+    case RT_EMERGENCY_STOP:
+      rt_emergency_stop();
+      return true;
+    case RT_BREAK_WAIT:
+      cancel_heatup = true;
+      return true;
+    case RT_FEEDRATE_RESET:
+      rt_feedrate_delta = 0;
+      rt_pending = (rt_pending & ~RT_PENDING_FEEDRATE) | RT_PENDING_FEEDRATE_RESET;
+      return true;
+    case RT_FEEDRATE_PLUS_10:  rt_add_feedrate(10);  return true;
+    case RT_FEEDRATE_MINUS_10: rt_add_feedrate(-10); return true;
+    case RT_FEEDRATE_PLUS_1:   rt_add_feedrate(1);   return true;
+    case RT_FEEDRATE_MINUS_1:  rt_add_feedrate(-1);  return true;
+  }
+
+  bool end_of_word = (c == '\n' || c == '\r' || c == ' ' || c == '*');
+
+  switch (rt_state) {
+    case RT_STATE_RESET:
+      if (c == 'N') rt_state = RT_STATE_N;
+      else if (c == 'M') rt_state = RT_STATE_M;
+      else if (c != ' ' && c != '\n' && c != '\r') rt_state = RT_STATE_IGNORE;
+      break;
+    case RT_STATE_N:
+      if (c == 'M') rt_state = RT_STATE_M;
+      else if ((c < '0' || c > '9') && c != ' ' && c != '-') rt_state = RT_STATE_IGNORE;
+      break;
+    case RT_STATE_M:
+      rt_state = (c == '1') ? RT_STATE_M1 : RT_STATE_IGNORE;
+      break;
+    case RT_STATE_M1:
+      if (c == '0') rt_state = RT_STATE_M10;
+      else if (c == '1') rt_state = RT_STATE_M11;
+      else rt_state = RT_STATE_IGNORE;
+      break;
+    case RT_STATE_M10:
+      rt_state = (c == '8') ? RT_STATE_M108 : RT_STATE_IGNORE;
+      break;
+    case RT_STATE_M11:
+      rt_state = (c == '2') ? RT_STATE_M112 : RT_STATE_IGNORE;
+      break;
+    case RT_STATE_M108:
+      if (end_of_word) cancel_heatup = true;
+      rt_state = RT_STATE_IGNORE;
+      break;
+    case RT_STATE_M112:
+      if (end_of_word) rt_emergency_stop();
+      rt_state = RT_STATE_IGNORE;
+      break;
+    default:
+      break;
+  }
+
+  if (c == '\n' || c == '\r') rt_state = RT_STATE_RESET;
+
+  return false;
+}
+#endif // REALTIME_COMMANDS
+
+void store_char(unsigned char c) {
+  #ifdef REALTIME_COMMANDS
+    if (!rt_paused && rt_parse(c)) return;
+  #endif
+
   int i = (unsigned int)(rx_buffer.head + 1) % RX_BUFFER_SIZE;
 
   // if we should be storing the received character into the location
@@ -56,6 +172,26 @@ FORCE_INLINE void store_char(unsigned char c) {
   }
 #endif
 
+#if TX_BUFFER_SIZE > 0 && defined(M_USARTx_UDRE_vect)
+  // Sends the next pending byte. The interrupt disables itself once the
+  // buffer has been drained; write() enables it again.
+  ISR(M_USARTx_UDRE_vect) {
+    uint8_t t = tx_buffer.tail;
+    if (t == tx_buffer.head) {
+      cbi(M_UCSRxB, M_UDRIEx);
+      return;
+    }
+
+    M_UDRx = tx_buffer.buffer[t];
+    t = (t + 1) & (TX_BUFFER_SIZE - 1);
+    tx_buffer.tail = t;
+
+    if (t == tx_buffer.head) {
+      cbi(M_UCSRxB, M_UDRIEx);
+    }
+  }
+#endif
+
 // Constructors ////////////////////////////////////////////////////////////////
 
 MarlinSerial::MarlinSerial() { }
@@ -87,6 +223,10 @@ void MarlinSerial::begin(long baud) {
   M_UBRRxH = baud_setting >> 8;
   M_UBRRxL = baud_setting;
 
+  #if TX_BUFFER_SIZE > 0
+    tx_buffer.head = tx_buffer.tail = 0;
+  #endif
+
   sbi(M_UCSRxB, M_RXENx);
   sbi(M_UCSRxB, M_TXENx);
   sbi(M_UCSRxB, M_RXCIEx);
@@ -96,7 +236,70 @@ void MarlinSerial::end() {
   cbi(M_UCSRxB, M_RXENx);
   cbi(M_UCSRxB, M_TXENx);
   cbi(M_UCSRxB, M_RXCIEx);  
+  #if TX_BUFFER_SIZE > 0
+    cbi(M_UCSRxB, M_UDRIEx);
+  #endif
+}
+
+#if TX_BUFFER_SIZE > 0
+// Moves one pending byte to the USART by polling. Used when the UDRE
+// interrupt can't run (global interrupts disabled, e.g. from kill()).
+static FORCE_INLINE void tx_send_polled() {
+  while (!((M_UCSRxA) & (1 << M_UDREx)))
+    ;
+
+  uint8_t t = tx_buffer.tail;
+  M_UDRx = tx_buffer.buffer[t];
+  tx_buffer.tail = (t + 1) & (TX_BUFFER_SIZE - 1);
+}
+
+void MarlinSerial::write(uint8_t c) {
+  // Nothing queued and the data register is free: send it straight away.
+  if (tx_buffer.head == tx_buffer.tail && ((M_UCSRxA) & (1 << M_UDREx))) {
+    M_UDRx = c;
+    return;
+  }
+
+  // With interrupts off nobody drains the ring, so empty it by polling
+  // (keeping the byte order) and send this byte the same way.
+  if (!(SREG & _BV(SREG_I))) {
+    while (tx_buffer.head != tx_buffer.tail)
+      tx_send_polled();
+    while (!((M_UCSRxA) & (1 << M_UDREx)))
+      ;
+    M_UDRx = c;
+    return;
+  }
+
+  uint8_t h = tx_buffer.head;
+  uint8_t i = (h + 1) & (TX_BUFFER_SIZE - 1);
+
+  // Buffer full: either give up on this byte or wait for the ISR to free a slot.
+  #ifdef TX_BUFFER_DROP_ON_OVERFLOW
+    if (i == tx_buffer.tail) return;
+  #else
+    while (i == tx_buffer.tail)
+      ;
+  #endif
+
+  tx_buffer.buffer[h] = c;
+  tx_buffer.head = i;
+
+  sbi(M_UCSRxB, M_UDRIEx);
+}
+
+void MarlinSerial::flushTX(void) {
+  // Wait until every queued byte has been handed to the USART.
+  if (!(SREG & _BV(SREG_I))) {
+    while (tx_buffer.head != tx_buffer.tail)
+      tx_send_polled();
+    return;
+  }
+
+  while (tx_buffer.head != tx_buffer.tail)
+    ;
 }
+#endif // TX_BUFFER_SIZE > 0
 
 
 int MarlinSerial::peek(void) {
@@ -55,6 +55,8 @@
 #define M_RXCx SERIAL_REGNAME(RXC,SERIAL_PORT,)
 #define M_USARTx_RX_vect SERIAL_REGNAME(USART,SERIAL_PORT,_RX_vect)
 #define M_U2Xx SERIAL_REGNAME(U2X,SERIAL_PORT,)
+#define M_UDRIEx SERIAL_REGNAME(UDRIE,SERIAL_PORT,)
+#define M_USARTx_UDRE_vect SERIAL_REGNAME(USART,SERIAL_PORT,_UDRE_vect)
 
 
 #define DEC 10
@@ -82,6 +84,62 @@ struct ring_buffer {
   extern ring_buffer rx_buffer;
 #endif
 
+// Puts a received character in rx_buffer. Shared by the RX interrupt and
+// checkRx() so realtime commands are seen whichever path reads the USART.
+void store_char(unsigned char c);
+
+#ifdef REALTIME_COMMANDS
+  // Single byte realtime commands. They are taken out of the RX stream by
+  // store_char() and never reach the command queue, wherever they show up
+  // in a line. So they are control characters or bytes UTF-8 never uses
+  // (0xF5-0xFF), which no M117 message or file name can contain.
+  #define RT_STATUS_REPORT      0x05 // ENQ: print a status line
+  #define RT_EMERGENCY_STOP     0x18 // CAN: same as M112
+  #define RT_BREAK_WAIT         0x1B // ESC: same as M108
+  #define RT_FEEDRATE_RESET     0xF5 // Feedrate override back to 100%
+  #define RT_FEEDRATE_PLUS_10   0xF6
+  #define RT_FEEDRATE_MINUS_10  0xF7
+  #define RT_FEEDRATE_PLUS_1    0xF8
+  #define RT_FEEDRATE_MINUS_1   0xF9
+
+  // Work the RX interrupt can't do itself (printing, touching multi-byte
+  // globals) is left here and done by manage_realtime_commands().
+  #define RT_PENDING_STATUS          0x01
+  #define RT_PENDING_FEEDRATE_RESET  0x02
+  #define RT_PENDING_FEEDRATE        0x04
+  #define RT_PENDING_KILL            0x08
+
+  extern volatile uint8_t rt_pending;
+  extern volatile int8_t rt_feedrate_delta;
+
+  // Set while the port carries binary data (M28 B1), whose bytes may take
+  // any value and must all reach rx_buffer.
+  extern volatile bool rt_paused;
+#endif // REALTIME_COMMANDS
+
+// Outgoing data is queued in a second ring buffer and sent from the USART
+// data register empty interrupt. Indexes are single bytes so the ISR and
+// write() can update them without a critical section.
+#ifndef TX_BUFFER_SIZE
+  #define TX_BUFFER_SIZE 0
+#endif
+
+#if TX_BUFFER_SIZE > 0
+  #if (TX_BUFFER_SIZE & (TX_BUFFER_SIZE - 1)) != 0 || TX_BUFFER_SIZE > 128
+    #error "TX_BUFFER_SIZE must be a power of 2 no larger than 128"
+  #endif
+
+  struct tx_ring_buffer {
+    unsigned char buffer[TX_BUFFER_SIZE];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+  };
+
+  #if UART_PRESENT(SERIAL_PORT)
+    extern tx_ring_buffer tx_buffer;
+  #endif
+#endif
+
 class MarlinSerial { //: public Stream
 
   public:
@@ -96,6 +154,10 @@ class MarlinSerial { //: public Stream
       return (unsigned int)(RX_BUFFER_SIZE + rx_buffer.head - rx_buffer.tail) % RX_BUFFER_SIZE;
     }
 
+#if TX_BUFFER_SIZE > 0
+    void write(uint8_t c);
+    void flushTX(void);
+#else
     FORCE_INLINE void write(uint8_t c) {
       while (!((M_UCSRxA) & (1 << M_UDREx)))
         ;
@@ -103,19 +165,13 @@ class MarlinSerial { //: public Stream
       M_UDRx = c;
     }
 
+    FORCE_INLINE void flushTX(void) { }
+#endif
+
     FORCE_INLINE void checkRx(void) {
       if ((M_UCSRxA & (1<<M_RXCx)) != 0) {
         unsigned char c  =  M_UDRx;
-        int i = (unsigned int)(rx_buffer.head + 1) % RX_BUFFER_SIZE;
-
-        // if we should be storing the received character into the location
-        // just before the tail (meaning that the head would advance to the
-        // current location of the tail), we're about to overflow the buffer
-        // and so we don't write the character or advance the head.
-        if (i != rx_buffer.tail) {
-          rx_buffer.buffer[rx_buffer.head] = c;
-          rx_buffer.head = i;
-        }
+        store_char(c);
       }
     }
 
@@ -75,6 +75,14 @@
 #include "Action.h"
 #include "GuiAction.h"
 
+#ifdef COMMAND_STATS
+  #include "CommandStats.h"
+#endif
+
+#ifdef PRINT_JOURNAL
+  #include "PrintJournal.h"
+#endif
+
 // look here for descriptions of G-codes: http://linuxcnc.org/handbook/gcode/g-code.html
 // http://objects.reprap.org/wiki/Mendel_User_Manual:_RepRapGCodes
 
@@ -109,7 +117,7 @@
 // M25  - Pause SD print
 // M26  - Set SD position in bytes (M26 S12345)
 // M27  - Report SD print status
-// M28  - Start SD write (M28 filename.g)
+// M28  - Start SD write (M28 filename.g). M28 B1 filename.g receives the file in binary frames (scripts/sd_upload.py)
 // M29  - Stop SD write
 // M30  - Delete file from SD (M30 filename.g)
 // M31  - Output time since last M109 or SD card start to serial
@@ -133,6 +141,7 @@
 // M109 - Sxxx Wait for extruder current temp to reach target temp. Waits only when heating
 //        Rxxx Wait for extruder current temp to reach target temp. Waits when heating and cooling
 //        IF AUTOTEMP is enabled, S<mintemp> B<maxtemp> F<factor>. Exit autotemp by any M109 without F
+// M108 - Stop waiting for heaters (M109/M190)
 // M112 - Emergency stop
 // M114 - Output current position to serial port
 // M115 - Capabilities string
@@ -144,6 +153,7 @@
 // M129 - EtoP Closed (BariCUDA EtoP = electricity to air pressure transducer by jmil)
 // M140 - Set bed target temp
 // M150 - Set BlinkM Color Output R: Red<0-255> U(!): Green<0-255> B: Blue<0-255> over i2c, G for green does not work.
+// M155 - S<seconds> Send the temperatures every S seconds (S0 disables), P1 adds the position
 // M190 - Sxxx Wait for bed current temp to reach target temp. Waits only when heating
 //        Rxxx Wait for bed current temp to reach target temp. Waits when heating and cooling
 // M200 D<millimeters>- set filament diameter and set E axis units to cubic millimeters (use S0 to set back to millimeters).
@@ -187,6 +197,12 @@
 // M700 - Level plate script for use with Witbox printer.
 // M701 - Load filament script for use with Witbox printer.
 // M702 - Unload filament script for use with Witbox printer.
+// M860 - Report per-command call count and execution time, and the time of loop() and of the display update in it. R resets the counters.
+// M861 - Report the current layer of the selected SD file. L<n> moves to the start of layer n for M24 to resume from.
+// M862 - Report the SD print interrupted by a power loss. R resumes it from its last checkpoint.
+// M863 - SD card benchmark: times listing the working folder, reading the selected file and writing a scratch file.
+// M864 - Report how long the print screen takes to redraw. R resets the counters.
+// M865 - Play a script of encoder (L, R) and button (P) events on the display and time each redraw (D redraws whole).
 // M907 - Set digital trimpot motor current using axis codes.
 // M908 - Control digital trimpot directly.
 // M350 - Set microstepping mode.
@@ -362,7 +378,7 @@ int fanSpeed = 0;
   float axis_scaling[3] = { 1, 1, 1 };    // Build size scaling, default to 1
 #endif				
 
-bool cancel_heatup = false;
+volatile bool cancel_heatup = false;
 
 #ifdef FILAMENT_SENSOR
   //Variables for Filament Sensor input 
@@ -404,6 +420,9 @@ static bool relative_mode = false;  //Determines Absolute or Relative Coordinate
 
 static char cmdbuffer[BUFSIZE][MAX_CMD_SIZE];
 static bool fromsd[BUFSIZE];
+#if defined(SD_LAYER_INDEX) || defined(PRINT_JOURNAL)
+  static uint32_t cmdsdpos[BUFSIZE]; // where each SD command starts in the file
+#endif
 static int bufindr = 0;
 static int bufindw = 0;
 static int buflen = 0;
@@ -415,6 +434,12 @@ static char *strchr_pointer; ///< A pointer to find chars in the command string
 
 const int sensitive_pins[] = SENSITIVE_PINS; ///< Sensitive pin list for M42
 
+#ifdef AUTO_REPORT_STATUS
+static uint8_t auto_report_interval = 0; // Seconds between status lines, 0 = off
+static bool auto_report_position = false; // Add the position to the line (M155 P1)
+static unsigned long next_auto_report_ms = 0;
+#endif
+
 // Inactivity shutdown
 unsigned long previous_millis_cmd = 0;
 static unsigned long max_inactive_time = 0;
@@ -481,6 +506,11 @@ void serial_echopair_P(const char *s_P, unsigned long v)
   }
 #endif //!SDSUPPORT
 
+#ifdef HOST_BUILD
+// Lets the host build tell when every received command has been run.
+bool host_commands_pending() { return buflen > 0; }
+#endif
+
 //adds an command to the main command buffer
 //thats really done in a non-safe way.
 //needs overworking someday
@@ -697,6 +727,10 @@ void setup()
   }
 #endif //DOGLCD
 
+#ifdef PRINT_JOURNAL
+  PrintJournal::single::instance().report();
+#endif
+
   lcd_init();
   _delay_ms(1000);	// wait 1sec to display the splash screen
 
@@ -727,9 +761,17 @@ uint16_t stop_buffer_code = 0;
 
 void loop()
 {
+#ifdef COMMAND_STATS
+	CommandStats::Sample loop_sample(CommandStats::loop_entry);
+#endif // COMMAND_STATS
+
+	// Commands wait while the display steps its own moves, so the host and
+	// the display don't change current_position under each other
+	bool hold_commands = gui_action_busy();
+
 	if (stop_buffer == false)
 	{
-    	if (buflen < (BUFSIZE-1))
+    	if (buflen < (BUFSIZE-1) && hold_commands == false)
 		{
 			get_command();
 		}
@@ -785,7 +827,7 @@ void loop()
   #ifdef SDSUPPORT
   card.checkautostart(false);
   #endif
-  if(buflen)
+  if(buflen && hold_commands == false)
   {
     #ifdef SDSUPPORT
       if(card.saving)
@@ -822,7 +864,15 @@ void loop()
   //check heater every n milliseconds
   temp::TemperatureManager::single::instance().manageTemperatureControl();
   checkHitEndstops();
+  gui_action_update();
+#ifdef COMMAND_STATS
+  {
+    CommandStats::Sample ui_sample(CommandStats::ui_entry);
+    lcd_update();
+  }
+#else
   lcd_update();
+#endif // COMMAND_STATS
 #ifndef DOGLCD
   manage_inactivity();
 #else
@@ -833,6 +883,13 @@ void loop()
 
 void get_command()
 {
+  #ifdef SD_FAST_UPLOAD
+    if(card.isBinaryUpload())
+    {
+      card.receiveBinaryUpload();
+      return;
+    }
+  #endif
   while( MYSERIAL.available() > 0  && buflen < BUFSIZE) {
     serial_char = MYSERIAL.read();
 
@@ -841,9 +898,15 @@ void get_command()
        serial_count >= (MAX_CMD_SIZE - 1) )
     {
 	#ifdef DOGLCD
+		cmdbuffer[bufindw][serial_count] = 0;
 		if ( SerialManager::single::instance().state() &&
 			 PrintManager::single::instance().state() != SERIAL_CONTROL &&
-			 PrintManager::single::instance().state() != INITIALIZING )
+			 PrintManager::single::instance().state() != INITIALIZING
+		#ifdef GUI_BENCHMARK
+			 // M865 plays its events on the views the serial screen would hide
+			 && strstr_P(cmdbuffer[bufindw], PSTR("M865")) == NULL
+		#endif // GUI_BENCHMARK
+			 )
 		{
 			if (ui::ViewManager::getInstance().getViewIndex() == ui::screen_main)
 			{
@@ -1013,39 +1076,35 @@ void get_command()
   static bool stop_buffering=false;
   if(buflen==0) stop_buffering=false;
 
-  while( !card.eof()  && buflen < BUFSIZE && !stop_buffering) {
-    int16_t n=card.get();
-    serial_char = (char)n;
-    if(serial_char == '\n' ||
-       serial_char == '\r' ||
-       (serial_char == '#' && comment_mode == false) ||
-       (serial_char == ':' && comment_mode == false) ||
-       serial_count >= (MAX_CMD_SIZE - 1)||n==-1)
-    {
-      if(serial_char=='#')
-        stop_buffering=true;
-
-      if(!serial_count)
-      {
-        comment_mode = false; //for new command
-        return; //if empty line
-      }
-      cmdbuffer[bufindw][serial_count] = 0; //terminate string
-//      if(!comment_mode){
-        fromsd[bufindw] = true;
-        buflen += 1;
-        bufindw = (bufindw + 1)%BUFSIZE;
-//      }
-      comment_mode = false; //for new command
-      serial_count = 0; //clear buffer
-    }
-    else
+  while( !card.eof()  && buflen < BUFSIZE && !stop_buffering && !card.readError) {
+    #if defined(SD_LAYER_INDEX) || defined(PRINT_JOURNAL)
+      cmdsdpos[bufindw] = card.getIndex();
+    #endif
+    // Empty and comment-only lines are skipped without leaving the loop.
+    if(card.getLine(cmdbuffer[bufindw], MAX_CMD_SIZE, stop_buffering) > 0)
     {
-      if(serial_char == ';') comment_mode = true;
-      if(!comment_mode) cmdbuffer[bufindw][serial_count++] = serial_char;
+      fromsd[bufindw] = true;
+      buflen += 1;
+      bufindw = (bufindw + 1)%BUFSIZE;
     }
   }
 
+  // The print is paused on the line that could not be read, resuming it
+  // tries that line again
+  if(card.readError)
+  {
+    card.readError = false;
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM(MSG_SD_ERR_READ);
+    LCD_ALERTMESSAGEPGM(MSG_SD_ERR_READ);
+#ifdef DOGLCD
+    PrintManager::pausePrint();
+#else
+    card.pauseSDPrint();
+#endif
+    return;
+  }
+
   if(card.eof() && buflen == 0){
 
     st_synchronize();
@@ -1575,8 +1634,178 @@ static void dock_sled(bool dock, int offset=0) {
 }
 #endif
 
+#ifdef SD_LAYER_INDEX
+// Restores the position, extruder and feedrate the selected SD file had at
+// the start of layer number and sets the file position there, so M24
+// resumes the print from that layer. The axes must be homed and the hotend
+// hot. The head travels at the height of the layer, so it must start
+// above the printed part.
+static void go_to_layer(uint16_t number)
+{
+  LayerIndex::Layer layer;
+
+  if (card.sdprinting || !card.layers.getLayer(number, layer))
+  {
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM("Layer not indexed or still printing");
+    return;
+  }
+  if (!axis_known_position[X_AXIS] || !axis_known_position[Y_AXIS] || !axis_known_position[Z_AXIS])
+  {
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM("Home the axes first");
+    return;
+  }
+
+  st_synchronize();
+  do_blocking_move_to(current_position[X_AXIS], current_position[Y_AXIS], max(current_position[Z_AXIS], layer.z));
+  do_blocking_move_to(layer.x, layer.y, current_position[Z_AXIS]);
+  do_blocking_move_to(layer.x, layer.y, layer.z);
+  z_height = layer.z;
+
+  current_position[E_AXIS] = layer.e;
+  plan_set_e_position(current_position[E_AXIS]);
+  feedrate = layer.feedrate;
+
+  card.setIndex(layer.offset);
+  card.layers.setLayer(number, layer.z);
+
+  SERIAL_ECHO_START;
+  SERIAL_ECHOPGM("At layer ");
+  SERIAL_ECHO(number);
+  SERIAL_ECHOPGM(" Z:");
+  SERIAL_ECHO(layer.z);
+  SERIAL_ECHOPGM(" byte ");
+  SERIAL_ECHOLN(layer.offset);
+}
+#endif // SD_LAYER_INDEX
+
+#ifdef PRINT_JOURNAL
+// Resumes the SD print the power cut from its newest checkpoint. Homing
+// and heating are left to the usual G28, M190 and M109, so each stage
+// queues them followed by the next stage: M862 R lifts the head, starts
+// the heaters and homes X and Y, S1 waits for the bed, S2 for the hotend
+// and S3 takes the head back and restarts the print. Z cannot be homed
+// with the part on the bed, so the bed must not have moved since the
+// power went away.
+static void resume_print(uint8_t stage)
+{
+  PrintJournal::Checkpoint checkpoint;
+  char path[PRINT_JOURNAL_PATH_LENGTH];
+  char command[16];
+
+  if (card.sdprinting || !PrintJournal::single::instance().load(checkpoint, path))
+  {
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM("No interrupted print or still printing");
+    return;
+  }
+  // With no target M109 S0 returns at once and the print goes on cold
+  if (checkpoint.hotend_target <= 0)
+  {
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM("No hotend temperature in the checkpoint, resume aborted");
+    return;
+  }
+  // buflen counts this command, and the commands queued are dropped
+  // when there is no room
+  if (BUFSIZE - buflen < 2)
+  {
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM("Command buffer full");
+    return;
+  }
+
+  switch (stage)
+  {
+    case 0:
+      card.openFile(path, true);
+      if (!card.isFileOpen())
+      {
+        return;
+      }
+
+      st_synchronize();
+      current_position[Z_AXIS] = checkpoint.z;
+      plan_set_position(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS], current_position[E_AXIS]);
+      axis_known_position[Z_AXIS] = true;
+      #ifndef LEVEL_SENSOR
+        // Only there G28 lifts the head before homing X and Y
+        do_blocking_move_to(current_position[X_AXIS], current_position[Y_AXIS], min(checkpoint.z + PRINT_JOURNAL_RAISE, Z_MAX_POS));
+      #endif
+
+      setTargetHotend(checkpoint.hotend_target, active_extruder);
+      #ifdef HEATED_BED_SUPPORT
+        setTargetBed(checkpoint.bed_target);
+      #endif
+      enquecommand_P(PSTR("G28 X0 Y0"));
+      enquecommand_P(PSTR("M862 S1"));
+      break;
+
+    case 1:
+      #ifdef HEATED_BED_SUPPORT
+        if (checkpoint.bed_target > 0)
+        {
+          sprintf_P(command, PSTR("M190 S%d"), checkpoint.bed_target);
+          enquecommand(command);
+        }
+      #endif
+      enquecommand_P(PSTR("M862 S2"));
+      break;
+
+    case 2:
+      sprintf_P(command, PSTR("M109 S%d"), checkpoint.hotend_target);
+      enquecommand(command);
+      enquecommand_P(PSTR("M862 S3"));
+      break;
+
+    case 3:
+      if (!card.isFileOpen() || !axis_known_position[X_AXIS] || !axis_known_position[Y_AXIS])
+      {
+        SERIAL_ERROR_START;
+        SERIAL_ERRORLNPGM("Resume aborted, send M862 R again");
+        return;
+      }
+
+      // G28 may have lifted the head without telling current_position
+      st_synchronize();
+      current_position[Z_AXIS] = plan_get_axis_position(Z_AXIS);
+      do_blocking_move_to(checkpoint.x, checkpoint.y, max(current_position[Z_AXIS], checkpoint.z));
+      do_blocking_move_to(checkpoint.x, checkpoint.y, checkpoint.z);
+      z_height = checkpoint.z;
+
+      current_position[E_AXIS] = checkpoint.e;
+      plan_set_e_position(current_position[E_AXIS]);
+      feedrate = checkpoint.feedrate;
+      fanSpeed = checkpoint.fan_speed;
+
+      card.setIndex(checkpoint.sdpos);
+      card.startFileprint();
+      starttime = millis();
+      feedmultiply = 100;
+      #ifdef DOGLCD
+        PrintManager::single::instance().state(PRINTING);
+      #endif
+
+      SERIAL_ECHO_START;
+      SERIAL_ECHOPGM("Resuming at Z:");
+      SERIAL_ECHO(checkpoint.z);
+      SERIAL_ECHOPGM(" byte ");
+      SERIAL_ECHOLN(checkpoint.sdpos);
+      break;
+
+    default:
+      break;
+  }
+}
+#endif // PRINT_JOURNAL
+
 void process_commands()
 {
+  #ifdef COMMAND_STATS
+    CommandStats::Sample stats_sample(cmdbuffer[bufindr]);
+  #endif
+
   unsigned long codenum; //throw away variable
   char *starpos = NULL;
 
@@ -1589,6 +1818,12 @@ void process_commands()
     case 1: // G1
       if(Stopped == false) {
         get_coordinates(); // For X Y Z E F
+          #ifdef SD_LAYER_INDEX
+            if(fromsd[bufindr]) card.layers.record(cmdsdpos[bufindr], current_position, destination, feedrate);
+          #endif
+          #ifdef PRINT_JOURNAL
+            if(fromsd[bufindr] && card.sdprinting) PrintJournal::single::instance().capture(cmdsdpos[bufindr], current_position, destination, feedrate);
+          #endif
           #ifdef FWRETRACT
             if(autoretract_enabled)
             if( !(code_seen('X') || code_seen('Y') || code_seen('Z')) && code_seen('E')) {
@@ -1851,6 +2086,10 @@ void process_commands()
 #endif
         st_synchronize();
         enable_endstops(true);
+        #ifdef SD_LAYER_INDEX
+          // The layers recorded so far are saved while the print waits
+          card.layers.flush();
+        #endif
 
         update_position = plan_get_position();
         current_position[X_AXIS] = update_position.x;
@@ -1939,6 +2178,20 @@ void process_commands()
         strchr_pointer = strchr(npos,' ') + 1;
         *(starpos) = '\0';
       }
+      #ifdef SD_FAST_UPLOAD
+        // M28 B1 <file> receives the file in binary frames
+        if(strncmp_P(strchr_pointer + 4, PSTR("B1 "), 3) == 0)
+        {
+          card.openFile(strchr_pointer + 7, false);
+          if(card.saving && !card.startBinaryUpload())
+          {
+            card.closefile();
+            SERIAL_ERROR_START;
+            SERIAL_ERRORLNPGM("No memory for a binary upload");
+          }
+          break;
+        }
+      #endif
       card.openFile(strchr_pointer+4,false);
       break;
     case 29: //M29 - Stop SD write
@@ -2322,6 +2575,11 @@ Sigma_Exit:
 #endif
       setWatch();
       break;
+    case 108: // M108 - Stop waiting for heaters
+      // Normally handled as soon as it is received (REALTIME_COMMANDS), but
+      // it can also come from the queue, e.g. when printing from SD.
+      cancel_heatup = true;
+      break;
     case 112: //  M112 -Emergency Stop
       kill();
       break;
@@ -2334,64 +2592,9 @@ Sigma_Exit:
       if(setTargetedHotend(105)){
         break;
         }
-      #if defined(TEMP_0_PIN) && TEMP_0_PIN > -1
-        SERIAL_PROTOCOLPGM("ok T:");
-        SERIAL_PROTOCOL_F(degHotend(tmp_extruder),1);
-        SERIAL_PROTOCOLPGM(" /");
-        SERIAL_PROTOCOL_F(degTargetHotend(tmp_extruder),1);
-        #if defined(TEMP_BED_PIN) && TEMP_BED_PIN > -1
-          SERIAL_PROTOCOLPGM(" B:");
-          SERIAL_PROTOCOL_F(degBed(),1);
-          SERIAL_PROTOCOLPGM(" /");
-          SERIAL_PROTOCOL_F(degTargetBed(),1);
-        #endif //TEMP_BED_PIN
-        for (int8_t cur_extruder = 0; cur_extruder < EXTRUDERS; ++cur_extruder) {
-          SERIAL_PROTOCOLPGM(" T");
-          SERIAL_PROTOCOL(cur_extruder);
-          SERIAL_PROTOCOLPGM(":");
-          SERIAL_PROTOCOL_F(degHotend(cur_extruder),1);
-          SERIAL_PROTOCOLPGM(" /");
-          SERIAL_PROTOCOL_F(degTargetHotend(cur_extruder),1);
-        }
-      #else
-        SERIAL_ERROR_START;
-        SERIAL_ERRORLNPGM(MSG_ERR_NO_THERMISTORS);
-      #endif
-
-        SERIAL_PROTOCOLPGM(" @:");
-      #ifdef EXTRUDER_WATTS
-        SERIAL_PROTOCOL((EXTRUDER_WATTS * getHeaterPower(tmp_extruder))/127);
-        SERIAL_PROTOCOLPGM("W");
-      #else
-        SERIAL_PROTOCOL(getHeaterPower(tmp_extruder));
-      #endif
-
-        SERIAL_PROTOCOLPGM(" B@:");
-      #ifdef BED_WATTS
-        SERIAL_PROTOCOL((BED_WATTS * getHeaterPower(-1))/127);
-        SERIAL_PROTOCOLPGM("W");
-      #else
-        SERIAL_PROTOCOL(getHeaterPower(-1));
-      #endif
-
-        #ifdef SHOW_TEMP_ADC_VALUES
-          #if defined(TEMP_BED_PIN) && TEMP_BED_PIN > -1
-            SERIAL_PROTOCOLPGM("    ADC B:");
-            SERIAL_PROTOCOL_F(degBed(),1);
-            SERIAL_PROTOCOLPGM("C->");
-            SERIAL_PROTOCOL_F(rawBedTemp()/OVERSAMPLENR,0);
-          #endif
-          for (int8_t cur_extruder = 0; cur_extruder < EXTRUDERS; ++cur_extruder) {
-            SERIAL_PROTOCOLPGM("  T");
-            SERIAL_PROTOCOL(cur_extruder);
-            SERIAL_PROTOCOLPGM(":");
-            SERIAL_PROTOCOL_F(degHotend(cur_extruder),1);
-            SERIAL_PROTOCOLPGM("C->");
-            SERIAL_PROTOCOL_F(rawHotendTemp(cur_extruder)/OVERSAMPLENR,0);
-          }
-        #endif
-
-        SERIAL_PROTOCOLLN("");
+      SERIAL_PROTOCOLPGM("ok");
+      print_heaterstates(tmp_extruder);
+      SERIAL_PROTOCOLLN("");
       return;
       break;
     case 109:
@@ -2446,7 +2649,7 @@ Sigma_Exit:
         while((!cancel_heatup)&&((residencyStart == -1) ||
               (residencyStart >= 0 && (((unsigned int) (millis() - residencyStart)) < (TEMP_RESIDENCY_TIME * 1000UL)))) ) {
       #else
-        while ( target_direction ? (isHeatingHotend(tmp_extruder)) : (isCoolingHotend(tmp_extruder)&&(CooldownNoWait==false)) ) {
+        while ( (!cancel_heatup) && (target_direction ? (isHeatingHotend(tmp_extruder)) : (isCoolingHotend(tmp_extruder)&&(CooldownNoWait==false))) ) {
       #endif //TEMP_RESIDENCY_TIME
           if( (millis() - codenum) > 1000UL )
           { //Print Temp Reading and remaining time every 1 second while heating up/cooling down
@@ -2515,7 +2718,7 @@ Sigma_Exit:
         cancel_heatup = false;
         target_direction = isHeatingBed(); // true if heating, false if cooling
 
-        while ( (target_direction)&&(!cancel_heatup) ? (isHeatingBed()) : (isCoolingBed()&&(CooldownNoWait==false)) )
+        while ( (!cancel_heatup) && (target_direction ? (isHeatingBed()) : (isCoolingBed()&&(CooldownNoWait==false))) )
         {
           if(( millis() - codenum) > 1000 ) //Print Temp Reading every 1 second while heating up.
           {
@@ -2727,14 +2930,7 @@ Sigma_Exit:
       break;
 
     case 114: // M114
-      SERIAL_PROTOCOLPGM("X:");
-      SERIAL_PROTOCOL(current_position[X_AXIS]);
-      SERIAL_PROTOCOLPGM(" Y:");
-      SERIAL_PROTOCOL(current_position[Y_AXIS]);
-      SERIAL_PROTOCOLPGM(" Z:");
-      SERIAL_PROTOCOL(current_position[Z_AXIS]);
-      SERIAL_PROTOCOLPGM(" E:");
-      SERIAL_PROTOCOL(current_position[E_AXIS]);
+      print_position();
 
       SERIAL_PROTOCOLPGM(MSG_COUNT_X);
       SERIAL_PROTOCOL(float(st_get_position(X_AXIS))/axis_steps_per_unit[X_AXIS]);
@@ -2814,6 +3010,19 @@ Sigma_Exit:
       }
       break;
     #endif //BLINKM
+    #ifdef AUTO_REPORT_STATUS
+    case 155: // M155 S<seconds> P<0|1> - Send the temperatures, and the position with P1, every S seconds, S0 disables it
+      if (code_seen('S'))
+      {
+        auto_report_interval = constrain(code_value(), 0, 60);
+        next_auto_report_ms = millis() + auto_report_interval * 1000UL;
+      }
+      if (code_seen('P'))
+      {
+        auto_report_position = (code_value_long() != 0);
+      }
+      break;
+    #endif //AUTO_REPORT_STATUS
     case 200: // M200 D<millimeters> set filament diameter and set E axis units to cubic millimeters (use S0 to set back to millimeters).
       {
 
@@ -4055,6 +4264,91 @@ case 404:  //M404 Enter the nominal filament width (3mm, 1.75mm ) N<3.0> or disp
       break;
 #endif // DOGLCD
 
+#ifdef SD_LAYER_INDEX
+    case 861: // M861 Report the layers of the selected SD file, L<n> to go to the start of layer n
+      if (!card.isFileOpen())
+      {
+        SERIAL_ERROR_START;
+        SERIAL_ERRORLNPGM("No SD file selected");
+      }
+      else if (code_seen('L'))
+      {
+        go_to_layer(code_value_long());
+      }
+      else
+      {
+        SERIAL_ECHO_START;
+        SERIAL_ECHOPGM("Layer ");
+        SERIAL_ECHO(card.layers.getCurrent());
+        if (card.layers.isComplete())
+        {
+          SERIAL_ECHOPGM(" of ");
+        }
+        else
+        {
+          SERIAL_ECHOPGM(", indexed so far: ");
+        }
+        SERIAL_ECHOLN(card.layers.getCount());
+      }
+      break;
+#endif // SD_LAYER_INDEX
+
+#ifdef PRINT_JOURNAL
+    case 862: // M862 Report the SD print interrupted by a power loss, R to resume it
+      if (code_seen('S'))
+      {
+        resume_print(code_value_long());
+      }
+      else if (code_seen('R'))
+      {
+        resume_print(0);
+      }
+      else if (!PrintJournal::single::instance().report())
+      {
+        SERIAL_ECHO_START;
+        SERIAL_ECHOLNPGM("No interrupted print");
+      }
+      break;
+#endif // PRINT_JOURNAL
+
+#ifdef SD_BENCHMARK
+    case 863: // M863 Time listing, reading and writing the SD card
+      card.benchmark();
+      break;
+#endif // SD_BENCHMARK
+
+#ifdef GUI_DRAW_STATS
+    case 864: // M864 Report print screen redraw times, R to reset them
+      if (code_seen('R'))
+      {
+        painter.resetDrawStats();
+      }
+      else
+      {
+        painter.reportDrawStats();
+      }
+      break;
+#endif // GUI_DRAW_STATS
+
+#ifdef GUI_BENCHMARK
+    case 865: // M865 Play encoder and button events and time the redraws
+      lcd_benchmark(strchr_pointer + 5);
+      break;
+#endif // GUI_BENCHMARK
+
+#ifdef COMMAND_STATS
+    case 860: // M860 Report command execution statistics, R to reset them
+      if (code_seen('R'))
+      {
+        CommandStats::single::instance().reset();
+      }
+      else
+      {
+        CommandStats::single::instance().report();
+      }
+      break;
+#endif // COMMAND_STATS
+
     case 907: // M907 Set digital trimpot motor current using axis codes.
     {
       #if defined(DIGIPOTSS_PIN) && DIGIPOTSS_PIN > -1
@@ -4262,6 +4556,156 @@ void ClearToSend()
   SERIAL_PROTOCOLLNPGM(MSG_OK);
 }
 
+// The temperatures as M105 reports them, without the "ok" and the end of
+// line, so the M155 report reads the same to hosts.
+void print_heaterstates(uint8_t extruder)
+{
+  #if defined(TEMP_0_PIN) && TEMP_0_PIN > -1
+    SERIAL_PROTOCOLPGM(" T:");
+    SERIAL_PROTOCOL_F(degHotend(extruder),1);
+    SERIAL_PROTOCOLPGM(" /");
+    SERIAL_PROTOCOL_F(degTargetHotend(extruder),1);
+    #if defined(TEMP_BED_PIN) && TEMP_BED_PIN > -1
+      SERIAL_PROTOCOLPGM(" B:");
+      SERIAL_PROTOCOL_F(degBed(),1);
+      SERIAL_PROTOCOLPGM(" /");
+      SERIAL_PROTOCOL_F(degTargetBed(),1);
+    #endif //TEMP_BED_PIN
+    for (int8_t cur_extruder = 0; cur_extruder < EXTRUDERS; ++cur_extruder) {
+      SERIAL_PROTOCOLPGM(" T");
+      SERIAL_PROTOCOL(cur_extruder);
+      SERIAL_PROTOCOLPGM(":");
+      SERIAL_PROTOCOL_F(degHotend(cur_extruder),1);
+      SERIAL_PROTOCOLPGM(" /");
+      SERIAL_PROTOCOL_F(degTargetHotend(cur_extruder),1);
+    }
+  #else
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM(MSG_ERR_NO_THERMISTORS);
+  #endif
+
+  SERIAL_PROTOCOLPGM(" @:");
+  #ifdef EXTRUDER_WATTS
+    SERIAL_PROTOCOL((EXTRUDER_WATTS * getHeaterPower(extruder))/127);
+    SERIAL_PROTOCOLPGM("W");
+  #else
+    SERIAL_PROTOCOL(getHeaterPower(extruder));
+  #endif
+
+  SERIAL_PROTOCOLPGM(" B@:");
+  #ifdef BED_WATTS
+    SERIAL_PROTOCOL((BED_WATTS * getHeaterPower(-1))/127);
+    SERIAL_PROTOCOLPGM("W");
+  #else
+    SERIAL_PROTOCOL(getHeaterPower(-1));
+  #endif
+
+  #ifdef SHOW_TEMP_ADC_VALUES
+    #if defined(TEMP_BED_PIN) && TEMP_BED_PIN > -1
+      SERIAL_PROTOCOLPGM("    ADC B:");
+      SERIAL_PROTOCOL_F(degBed(),1);
+      SERIAL_PROTOCOLPGM("C->");
+      SERIAL_PROTOCOL_F(rawBedTemp()/OVERSAMPLENR,0);
+    #endif
+    for (int8_t cur_extruder = 0; cur_extruder < EXTRUDERS; ++cur_extruder) {
+      SERIAL_PROTOCOLPGM("  T");
+      SERIAL_PROTOCOL(cur_extruder);
+      SERIAL_PROTOCOLPGM(":");
+      SERIAL_PROTOCOL_F(degHotend(cur_extruder),1);
+      SERIAL_PROTOCOLPGM("C->");
+      SERIAL_PROTOCOL_F(rawHotendTemp(cur_extruder)/OVERSAMPLENR,0);
+    }
+  #endif
+}
+
+// The position as the first part of the M114 answer, without the end of line.
+void print_position()
+{
+  SERIAL_PROTOCOLPGM("X:");
+  SERIAL_PROTOCOL(current_position[X_AXIS]);
+  SERIAL_PROTOCOLPGM(" Y:");
+  SERIAL_PROTOCOL(current_position[Y_AXIS]);
+  SERIAL_PROTOCOLPGM(" Z:");
+  SERIAL_PROTOCOL(current_position[Z_AXIS]);
+  SERIAL_PROTOCOLPGM(" E:");
+  SERIAL_PROTOCOL(current_position[E_AXIS]);
+}
+
+// Temperatures, then the position as M114 reports it and the feedrate
+// override. Unlike M105 and M114 it is not tied to a queued command and
+// sends no "ok".
+void report_status()
+{
+  print_heaterstates(active_extruder);
+  SERIAL_PROTOCOLLN("");
+  print_position();
+  SERIAL_PROTOCOLLN("");
+  SERIAL_ECHO_START;
+  SERIAL_ECHOPGM("FR:");
+  SERIAL_ECHO(feedmultiply);
+  SERIAL_ECHOLNPGM("%");
+}
+
+#ifdef REALTIME_COMMANDS
+// Finishes the realtime commands the RX interrupt could only flag. Called
+// from manageTemperatureControl(), which every wait loop already runs.
+void manage_realtime_commands()
+{
+  if (rt_pending == 0)
+    return;
+
+  if (rt_pending & RT_PENDING_KILL)
+  {
+    kill();
+  }
+
+  CRITICAL_SECTION_START;
+  uint8_t pending = rt_pending;
+  int8_t feedrate_delta = rt_feedrate_delta;
+  rt_pending = 0;
+  rt_feedrate_delta = 0;
+  CRITICAL_SECTION_END;
+
+  if (pending & RT_PENDING_FEEDRATE_RESET)
+  {
+    feedmultiply = 100;
+  }
+  if (pending & RT_PENDING_FEEDRATE)
+  {
+    feedmultiply = constrain(feedmultiply + feedrate_delta, 10, 999);
+  }
+  if (pending & RT_PENDING_STATUS)
+  {
+    report_status();
+  }
+}
+#endif // REALTIME_COMMANDS
+
+#ifdef AUTO_REPORT_STATUS
+// Sends the M155 status line when its interval has elapsed. Like
+// manage_realtime_commands() it runs from manageTemperatureControl(), so the
+// report keeps coming during M109, G29 or a full planner buffer.
+void manage_auto_report()
+{
+  if (auto_report_interval == 0)
+    return;
+
+  unsigned long now = millis();
+  if ((long)(now - next_auto_report_ms) < 0)
+    return;
+
+  next_auto_report_ms = now + auto_report_interval * 1000UL;
+  print_heaterstates(active_extruder);
+  if (auto_report_position)
+  {
+    // After the temperatures, so the line still reads as an M105 answer
+    SERIAL_PROTOCOLPGM(" ");
+    print_position();
+  }
+  SERIAL_PROTOCOLLN("");
+}
+#endif // AUTO_REPORT_STATUS
+
 void get_coordinates()
 {
   bool seen[4]={false,false,false,false};
@@ -4691,6 +5135,12 @@ void manage_inactivity(bool ignore_stepper_queue/*=false*/) //default argument s
   if( (millis() - previous_millis_cmd) >  max_inactive_time )
     if(max_inactive_time)
       kill();
+
+#ifdef REALTIME_COMMANDS
+  // Emergency stop received by the RX interrupt
+  if (rt_pending & RT_PENDING_KILL)
+    kill();
+#endif
   // if(stepper_inactive_time)  {
   //   if( (millis() - previous_millis_cmd) >  stepper_inactive_time )
   //   {
@@ -0,0 +1,309 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file PrintJournal.cpp
+///
+/// \brief Power loss checkpoints of SD prints, kept in EEPROM.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "Marlin.h"
+#include "planner.h"
+#include "temperature.h"
+#include "PrintJournal.h"
+
+#ifdef PRINT_JOURNAL
+
+#include <stddef.h>
+#include <avr/eeprom.h>
+
+// EEPROM layout, in the free space between the settings and the protected
+// zone (see StorageManager.cpp)
+#define JOURNAL_PRINT   1024  // id of the last print started
+#define JOURNAL_ACTIVE  1025  // JOURNAL_ACTIVE_MARK while that print runs
+#define JOURNAL_PATH    1026  // absolute path of its file
+#define JOURNAL_SLOTS   (JOURNAL_PATH + PRINT_JOURNAL_PATH_LENGTH)
+
+#define JOURNAL_ACTIVE_MARK 0x4A
+
+#define EEPROM_ADDRESS(address) ((uint8_t *)(address))
+
+static_assert(JOURNAL_SLOTS + PRINT_JOURNAL_SLOTS * sizeof(PrintJournal::Checkpoint) <= 4068,
+	"The print journal must end before the protected EEPROM zone");
+
+// Sequences wrap around, the newest is the one less than half a turn ahead
+static inline bool newer(uint16_t a, uint16_t b)
+{
+	return (int16_t)(a - b) > 0;
+}
+
+PrintJournal::PrintJournal()
+	: m_active(false)
+	, m_state(IDLE)
+	, m_print(0)
+	, m_sequence(0)
+	, m_slot(0)
+	, m_written(0)
+	, m_block(0)
+	, m_last_ms(0)
+	, m_layer_z(-1)
+{
+	m_path[0] = '\0';
+}
+
+//! Remembers the absolute path of the file just opened for printing.
+void PrintJournal::select(const char * path)
+{
+	if (strlen(path) < sizeof(m_path))
+	{
+		strcpy(m_path, path);
+	}
+	else
+	{
+		// Too long to reopen, the file is printed without checkpoints
+		m_path[0] = '\0';
+	}
+}
+
+//! Called whenever the selected file starts or resumes printing. The print
+//! in the journal keeps its id if it is the same file, so a resumed print
+//! goes on from its own checkpoints.
+void PrintJournal::start()
+{
+	char path[PRINT_JOURNAL_PATH_LENGTH];
+	Checkpoint checkpoint;
+
+	m_active = false;
+	m_state = IDLE;
+	m_layer_z = -1;
+	m_last_ms = millis();
+
+	if (m_path[0] == '\0')
+	{
+		return;
+	}
+
+	m_print = eeprom_read_byte(EEPROM_ADDRESS(JOURNAL_PRINT));
+	eeprom_read_block(path, EEPROM_ADDRESS(JOURNAL_PATH), sizeof(path));
+
+	if (eeprom_read_byte(EEPROM_ADDRESS(JOURNAL_ACTIVE)) != JOURNAL_ACTIVE_MARK
+		|| strncmp(path, m_path, sizeof(path)) != 0)
+	{
+		// A new id no slot still holds, so no old checkpoint passes for one
+		// of this print
+		bool used;
+		do
+		{
+			m_print++;
+			used = false;
+			for (uint8_t slot = 0; slot < PRINT_JOURNAL_SLOTS && !used; slot++)
+			{
+				used = read(slot, checkpoint) && checkpoint.print == m_print;
+			}
+		} while (used);
+
+		eeprom_update_byte(EEPROM_ADDRESS(JOURNAL_ACTIVE), 0);
+		eeprom_update_block(m_path, EEPROM_ADDRESS(JOURNAL_PATH), strlen(m_path) + 1);
+		eeprom_update_byte(EEPROM_ADDRESS(JOURNAL_PRINT), m_print);
+		eeprom_update_byte(EEPROM_ADDRESS(JOURNAL_ACTIVE), JOURNAL_ACTIVE_MARK);
+	}
+
+	// Go on after the newest checkpoint of any print
+	bool found = false;
+	m_sequence = 0;
+	m_slot = 0;
+	for (uint8_t slot = 0; slot < PRINT_JOURNAL_SLOTS; slot++)
+	{
+		if (read(slot, checkpoint) && (!found || newer(checkpoint.sequence, m_sequence - 1)))
+		{
+			found = true;
+			m_sequence = checkpoint.sequence + 1;
+			m_slot = (slot + 1) % PRINT_JOURNAL_SLOTS;
+		}
+	}
+
+	m_active = true;
+}
+
+//! Called when the print ends or is cancelled, so there is nothing left to
+//! resume.
+void PrintJournal::stop()
+{
+	m_active = false;
+	m_state = IDLE;
+	eeprom_update_byte(EEPROM_ADDRESS(JOURNAL_ACTIVE), 0);
+}
+
+//! Called for every move read from the file, before it is planned. start
+//! and end are the positions before and after the move.
+void PrintJournal::capture(uint32_t sdpos, const float * start, const float * end, float feedrate)
+{
+	if (!m_active || m_state != IDLE)
+	{
+		return;
+	}
+
+	bool layer = end[E_AXIS] > start[E_AXIS] && fabs(end[Z_AXIS] - m_layer_z) >= PRINT_JOURNAL_LAYER_STEP;
+	if (!layer && millis() - m_last_ms < PRINT_JOURNAL_INTERVAL * 1000UL)
+	{
+		return;
+	}
+	if (layer)
+	{
+		m_layer_z = end[Z_AXIS];
+	}
+
+	m_checkpoint.print = m_print;
+	m_checkpoint.sequence = m_sequence;
+	m_checkpoint.sdpos = sdpos;
+	m_checkpoint.x = start[X_AXIS];
+	m_checkpoint.y = start[Y_AXIS];
+	m_checkpoint.z = start[Z_AXIS];
+	m_checkpoint.e = start[E_AXIS];
+	m_checkpoint.feedrate = feedrate;
+	// Not target_temperature[], which TemperatureManager leaves alone on DOGLCD
+	m_checkpoint.hotend_target = degTargetHotend(active_extruder);
+	m_checkpoint.bed_target = degTargetBed();
+	m_checkpoint.fan_speed = fanSpeed;
+	m_checkpoint.checksum = checksum(m_checkpoint);
+
+	// The move is about to take this block of the planner
+	m_block = block_buffer_head;
+	m_last_ms = millis();
+	m_state = WAITING;
+}
+
+//! Saves the pending checkpoint once the steppers reach its move, one
+//! byte per call and only when the EEPROM is free, so it never waits.
+void PrintJournal::update()
+{
+	switch (m_state)
+	{
+		case WAITING:
+			if (reached())
+			{
+				m_written = 0;
+				m_state = WRITING;
+			}
+			break;
+
+		case WRITING:
+			if (!eeprom_is_ready())
+			{
+				break;
+			}
+
+			eeprom_update_byte(EEPROM_ADDRESS(JOURNAL_SLOTS + m_slot * sizeof(Checkpoint) + m_written),
+				((uint8_t *) &m_checkpoint)[m_written]);
+
+			if (++m_written == sizeof(Checkpoint))
+			{
+				m_slot = (m_slot + 1) % PRINT_JOURNAL_SLOTS;
+				m_sequence++;
+				m_state = IDLE;
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+//! Reads the newest checkpoint of the print that was running when the
+//! power went away, and the path of its file.
+bool PrintJournal::load(Checkpoint & checkpoint, char * path)
+{
+	Checkpoint candidate;
+	bool found = false;
+
+	if (eeprom_read_byte(EEPROM_ADDRESS(JOURNAL_ACTIVE)) != JOURNAL_ACTIVE_MARK)
+	{
+		return false;
+	}
+
+	uint8_t print = eeprom_read_byte(EEPROM_ADDRESS(JOURNAL_PRINT));
+	for (uint8_t slot = 0; slot < PRINT_JOURNAL_SLOTS; slot++)
+	{
+		if (read(slot, candidate) && candidate.print == print
+			&& (!found || newer(candidate.sequence, checkpoint.sequence)))
+		{
+			checkpoint = candidate;
+			found = true;
+		}
+	}
+
+	if (found)
+	{
+		eeprom_read_block(path, EEPROM_ADDRESS(JOURNAL_PATH), PRINT_JOURNAL_PATH_LENGTH);
+		path[PRINT_JOURNAL_PATH_LENGTH - 1] = '\0';
+	}
+	return found;
+}
+
+//! Tells the host about the print the power cut, if there is one.
+bool PrintJournal::report()
+{
+	Checkpoint checkpoint;
+	char path[PRINT_JOURNAL_PATH_LENGTH];
+
+	if (!load(checkpoint, path))
+	{
+		return false;
+	}
+
+	SERIAL_ECHO_START;
+	SERIAL_ECHOPGM("Interrupted print: ");
+	SERIAL_ECHO(path);
+	SERIAL_ECHOPGM(" Z:");
+	SERIAL_ECHO(checkpoint.z);
+	SERIAL_ECHOPGM(" byte ");
+	SERIAL_ECHO(checkpoint.sdpos);
+	SERIAL_ECHOLNPGM(", M862 R to resume");
+	return true;
+}
+
+uint8_t PrintJournal::checksum(const Checkpoint & checkpoint)
+{
+	const uint8_t * bytes = (const uint8_t *) &checkpoint;
+	uint8_t sum = 0;
+
+	for (uint8_t i = 0; i < offsetof(Checkpoint, checksum); i++)
+	{
+		sum += bytes[i];
+	}
+
+	// Neither an erased (0xFF) nor a zeroed slot is valid
+	return ~sum;
+}
+
+bool PrintJournal::read(uint8_t slot, Checkpoint & checkpoint)
+{
+	eeprom_read_block(&checkpoint, EEPROM_ADDRESS(JOURNAL_SLOTS + slot * sizeof(Checkpoint)), sizeof(checkpoint));
+	return checkpoint.checksum == checksum(checkpoint);
+}
+
+//! True once the steppers are on the checkpointed move or past it.
+bool PrintJournal::reached()
+{
+	uint8_t tail = block_buffer_tail;
+	uint8_t ahead = (m_block - tail) & (BLOCK_BUFFER_SIZE - 1);
+	uint8_t queued = (block_buffer_head - tail) & (BLOCK_BUFFER_SIZE - 1);
+
+	// Either the block is the one running or it has left the queue
+	return ahead == 0 || ahead > queued;
+}
+
+#endif //PRINT_JOURNAL
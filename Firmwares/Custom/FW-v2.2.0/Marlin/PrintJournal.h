@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file PrintJournal.h
+///
+/// \brief Power loss checkpoints of SD prints, kept in EEPROM.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef PRINT_JOURNAL_H
+#define PRINT_JOURNAL_H
+
+#include <stdint.h>
+
+#include "Singleton.h"
+
+#ifdef PRINT_JOURNAL
+
+#ifndef PRINT_JOURNAL_INTERVAL
+	#define PRINT_JOURNAL_INTERVAL 30
+#endif //PRINT_JOURNAL_INTERVAL
+
+// Smallest change of Z between two extruding moves that starts a layer,
+// the same rule the layer index uses
+#define PRINT_JOURNAL_LAYER_STEP 0.05
+#define PRINT_JOURNAL_PATH_LENGTH 64
+#define PRINT_JOURNAL_SLOTS 64
+
+// Lift of the head before X and Y are homed to resume a print
+#define PRINT_JOURNAL_RAISE 5
+
+//! \brief Saves where an SD print is, so it can be resumed after the power
+//! goes away.
+//!
+//! A checkpoint is taken as the first move of every layer is read, or after
+//! PRINT_JOURNAL_INTERVAL seconds without one. It is only saved once the
+//! steppers have reached that move, so a resumed print may repeat a few
+//! moves but never skips any. Checkpoints go round robin through
+//! PRINT_JOURNAL_SLOTS EEPROM slots one byte per call to update(), so saving
+//! one never stalls the print and the wear is spread over the slots. A
+//! checksum rejects a slot the power cut while it was written; the newest
+//! valid slot of the print wins.
+class PrintJournal
+{
+	public:
+		typedef Singleton<PrintJournal> single;
+
+		struct Checkpoint
+		{
+			uint8_t print;        // id of the print it belongs to
+			uint16_t sequence;    // the highest one is the newest
+			uint32_t sdpos;       // first byte of the line to resume from
+			float x;              // position before that line
+			float y;
+			float z;
+			float e;
+			float feedrate;       // mm/min
+			int16_t hotend_target;
+			int16_t bed_target;
+			uint8_t fan_speed;
+			uint8_t checksum;
+		};
+
+	public:
+		PrintJournal();
+
+		void select(const char * path);
+		void start();
+		void stop();
+		void capture(uint32_t sdpos, const float * start, const float * end, float feedrate);
+		void update();
+
+		bool load(Checkpoint & checkpoint, char * path);
+		bool report();
+
+	private:
+		typedef enum
+		{
+			IDLE = 0,
+			WAITING,  // taken, the steppers have not reached it yet
+			WRITING,
+		} State_t;
+
+		static uint8_t checksum(const Checkpoint & checkpoint);
+		static bool read(uint8_t slot, Checkpoint & checkpoint);
+		bool reached();
+
+	private:
+		char m_path[PRINT_JOURNAL_PATH_LENGTH];  // file selected to print
+		bool m_active;
+		State_t m_state;
+		uint8_t m_print;
+		uint16_t m_sequence;
+		uint8_t m_slot;
+		uint8_t m_written;      // bytes of m_checkpoint already in EEPROM
+		uint8_t m_block;        // planner block of the checkpointed move
+		unsigned long m_last_ms;
+		float m_layer_z;
+		Checkpoint m_checkpoint;
+};
+
+#endif //PRINT_JOURNAL
+#endif //PRINT_JOURNAL_H
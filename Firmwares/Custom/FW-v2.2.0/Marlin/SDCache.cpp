@@ -51,6 +51,9 @@ void SDCache::reloadCache()
 	m_index = 0;
 	m_selected_file = 0;
 	m_list_length = card.getnrfilenames() + 1;
+#ifdef SD_SORT
+	m_sort.update(m_list_length - 1);
+#endif //SD_SORT
 
 	if (m_list_length < LCD_HEIGHT) 
 	{
@@ -86,6 +89,7 @@ bool SDCache::updateCachePosition(int16_t index)
 	//return_value is set to true if window has moved
     bool return_value = false;
     bool update_window = false;
+    uint16_t previous_cache_min = m_cache_min;
     
     if(m_window_is_centered == true)
 	{
@@ -130,14 +134,12 @@ bool SDCache::updateCachePosition(int16_t index)
 				m_cache_max = m_window_max;
 				m_cache_min = m_cache_max - (m_cache_size - 1);
 				return_value = true;
-				m_cache_update = true;
 			}
 			else
 			{
 				m_cache_min = 0;
 				m_cache_max = m_cache_min + (m_cache_size - 1);
 				return_value = true;
-				m_cache_update = true;	
 			}
 			
 		}
@@ -148,14 +150,12 @@ bool SDCache::updateCachePosition(int16_t index)
 				m_cache_min = m_window_min;
 				m_cache_max = m_cache_min + (m_cache_size - 1);
 				return_value = true;
-				m_cache_update = true;
 			}
 			else
 			{
 				m_cache_max = m_list_length-1;
 				m_cache_min = m_cache_max - (m_cache_size - 1);
 				return_value = true;
-				m_cache_update = true;
 			}
 		}
 		
@@ -168,60 +168,12 @@ bool SDCache::updateCachePosition(int16_t index)
 	}
 	
 	if(m_cache_update == true)
-	{		
-		memset(m_cache, 0, sizeof(m_cache));
-		
-		int8_t cache_position = m_cache_size;
-		uint16_t file_to_read = m_list_length - m_cache_max - 1; // + 2;
-		
-		while(cache_position > 0)
-		{
-			if(file_to_read == m_list_length-1)
-			{
-				if(getFolderIsRoot())
-				{
-					m_cache[0].type = BACK_ENTRY;
-					strcpy(m_cache[0].longFilename, "Back");
-					strcpy(m_cache[0].filename, "Back");
-				}
-				else
-				{
-					m_cache[0].type = UPDIR_ENTRY;
-					strcpy(m_cache[0].longFilename, "..");
-					strcpy(m_cache[0].filename, "..");
-				}
-				
-				break;
-			}			
-			
-			card.getfilename(file_to_read);
-			
-			
-			if (card.filenameIsDir) 
-			{
-				m_cache[cache_position-1].type = FOLDER_ENTRY;				
-			}
-			else 
-			{
-				m_cache[cache_position-1].type = FILE_ENTRY;
-			}
-			
-			strcpy(m_cache[cache_position-1].filename, card.filename);
-			if(strlen(card.longFilename) == 0)
-			{
-				strcpy(m_cache[cache_position-1].longFilename, card.filename);
-			}
-			else
-			{
-				strcpy(m_cache[cache_position-1].longFilename, card.longFilename);
-			}
-						
-			++file_to_read;
-			--cache_position;
-			
-			
-			
-		}
+	{
+		fillCache(0, m_cache_size);
+	}
+	else if(m_cache_min != previous_cache_min)
+	{
+		slideCache(previous_cache_min);
 	}
 	
 	if(update_window || m_cache_update)
@@ -259,7 +211,7 @@ CacheEntryType_t SDCache::press(uint16_t index)
 	{
 		//cases handled outside of SDCache
 		case FILE_ENTRY:
-			card.getfilename(m_list_length - m_index - 1);
+			getFilename(m_list_length - m_index - 1);
 		case BACK_ENTRY:
 			return getSelectedEntry()->type; 
 			break;
@@ -321,6 +273,82 @@ void SDCache::changeDir()
 	}
 }
 
+//! Moves the entries still in range to their new slots and reads only the
+//! ones entering the cache, so scrolling costs one entry per step.
+void SDCache::slideCache(uint16_t previous_cache_min)
+{
+	if(m_cache_min > previous_cache_min && m_cache_min - previous_cache_min < m_cache_size)
+	{
+		uint8_t shift = m_cache_min - previous_cache_min;
+		memmove(m_cache, m_cache + shift, (m_cache_size - shift) * sizeof(cache_entry));
+		fillCache(m_cache_size - shift, m_cache_size);
+	}
+	else if(previous_cache_min > m_cache_min && previous_cache_min - m_cache_min < m_cache_size)
+	{
+		uint8_t shift = previous_cache_min - m_cache_min;
+		memmove(m_cache + shift, m_cache, (m_cache_size - shift) * sizeof(cache_entry));
+		fillCache(0, shift);
+	}
+	else
+	{
+		fillCache(0, m_cache_size);
+	}
+}
+
+//! Reads the slots from first up to last. They are read bottom up, which
+//! is the order of the entries in the folder.
+void SDCache::fillCache(uint8_t first, uint8_t last)
+{
+	for(uint8_t slot = last; slot-- > first; )
+	{
+		cache_entry * entry = m_cache + slot;
+		uint16_t list_index = m_cache_min + slot;
+		
+		memset(entry, 0, sizeof(cache_entry));
+		
+		if(list_index == 0)
+		{
+			if(getFolderIsRoot())
+			{
+				entry->type = BACK_ENTRY;
+				strcpy(entry->longFilename, "Back");
+				strcpy(entry->filename, "Back");
+			}
+			else
+			{
+				entry->type = UPDIR_ENTRY;
+				strcpy(entry->longFilename, "..");
+				strcpy(entry->filename, "..");
+			}
+			continue;
+		}
+		
+		getFilename(m_list_length - list_index - 1);
+		
+		entry->type = card.filenameIsDir ? FOLDER_ENTRY : FILE_ENTRY;
+		strcpy(entry->filename, card.filename);
+		if(strlen(card.longFilename) == 0)
+		{
+			strcpy(entry->longFilename, card.filename);
+		}
+		else
+		{
+			strcpy(entry->longFilename, card.longFilename);
+		}
+	}
+}
+
+//! Loads the entry shown at index into card. The list is filled from the
+//! bottom up, so with sorting on the last index is the first sorted entry.
+void SDCache::getFilename(uint16_t index)
+{
+#ifdef SD_SORT
+	card.getfilename(m_sort.order(m_list_length - 2 - index));
+#else
+	card.getfilename(index);
+#endif //SD_SORT
+}
+
 void SDCache::updateDirectoryName()
 {
 	char curDir[13];
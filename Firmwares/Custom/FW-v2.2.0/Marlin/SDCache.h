@@ -27,6 +27,7 @@
 #define SD_CACHE_H
 
 #include "cardreader.h"
+#include "SDSort.h"
 
 #ifndef SD_CACHE_SIZE
 	#define SD_CACHE_SIZE LCD_HEIGHT+2
@@ -77,6 +78,9 @@ class SDCache
 	private:
 		void changeDir();
 		void updateDirectoryName();
+		void getFilename(uint16_t index);
+		void slideCache(uint16_t previous_cache_min);
+		void fillCache(uint8_t first, uint8_t last);
 
 	public:
 		//cache to show, based on partial iterators to cache
@@ -102,6 +106,10 @@ class SDCache
 		
 		bool m_window_is_centered;
 		uint8_t m_window_offset;
+
+#ifdef SD_SORT
+		SDSort m_sort;
+#endif //SD_SORT
 };
 
 #endif //SD_CACHE_H
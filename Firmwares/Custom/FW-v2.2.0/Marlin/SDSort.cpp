@@ -0,0 +1,344 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file SDSort.cpp
+///
+/// \brief Sorted order of the entries of the current SD folder.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SDSort.h"
+
+#ifdef SD_SORT
+
+static_assert(SD_SORT_ENTRIES > 1, "SD_SORT_ENTRIES must be at least 2");
+
+typedef enum
+{
+	UNSORTED = 0,
+	SORTED_IN_RAM,
+	SORTED_IN_FILE,
+} SortMode_t;
+
+// Order of the list being shown, or numbers on their way to the index file
+static uint16_t sort_order[SD_SORT_ENTRIES];
+
+// Folder the order was built for
+static uint8_t sort_mode = UNSORTED;
+static uint16_t sort_count = 0;
+static uint16_t sort_signature = 0;
+
+#ifdef SD_SORT_INDEX_FILE
+	#define SD_SORT_MAGIC 0x5853
+
+	// The header is followed by two regions of sort_count numbers each. The
+	// merge passes go back and forth between them and the header tells
+	// which one holds the order.
+	static SdFile sort_file;
+	static uint8_t sort_region;
+#endif //SD_SORT_INDEX_FILE
+
+SDSort::SDSort()
+{ }
+
+//! Sorts the count entries of the working folder unless they are the ones
+//! sorted last. Called after card.getnrfilenames().
+void SDSort::update(uint16_t count)
+{
+	uint16_t signature = card.getDirSignature();
+
+	if (sort_mode == SORTED_IN_RAM && count == sort_count && signature == sort_signature)
+	{
+		return;
+	}
+
+	sort_mode = UNSORTED;
+	sort_count = count;
+	sort_signature = signature;
+#ifdef SD_SORT_INDEX_FILE
+	sort_file.close();
+#endif //SD_SORT_INDEX_FILE
+
+	if (count < 2)
+	{
+		return;
+	}
+
+	if (count <= SD_SORT_ENTRIES)
+	{
+		sortRun(0, count);
+		sort_mode = SORTED_IN_RAM;
+	}
+#ifdef SD_SORT_INDEX_FILE
+	// The file is opened again every time, in case the card was swapped
+	else if (loadIndex(count, signature) || buildIndex(count, signature))
+	{
+		sort_mode = SORTED_IN_FILE;
+	}
+#endif //SD_SORT_INDEX_FILE
+}
+
+uint16_t SDSort::order(uint16_t position)
+{
+	if (position < sort_count)
+	{
+		if (sort_mode == SORTED_IN_RAM)
+		{
+			return sort_order[position];
+		}
+#ifdef SD_SORT_INDEX_FILE
+		uint16_t nr;
+		if (sort_mode == SORTED_IN_FILE && readNumber(sort_region, position, nr))
+		{
+			return nr;
+		}
+#endif //SD_SORT_INDEX_FILE
+	}
+	return position;
+}
+
+//! Sorts the length entries numbered from first on into sort_order by
+//! binary insertion, so each entry takes about log2(length) reads of the
+//! others. Entries that compare equal keep their FAT order.
+void SDSort::sortRun(uint16_t first, uint16_t length)
+{
+	Entry entry;
+
+	for (uint16_t i = 0; i < length; i++)
+	{
+		readEntry(first + i, entry);
+
+		uint16_t low = 0;
+		uint16_t high = i;
+		while (low < high)
+		{
+			uint16_t middle = (low + high) / 2;
+			card.getfilename(sort_order[middle]);
+			if (before(entry))
+			{
+				high = middle;
+			}
+			else
+			{
+				low = middle + 1;
+			}
+		}
+
+		memmove(&sort_order[low + 1], &sort_order[low], (i - low) * sizeof(sort_order[0]));
+		sort_order[low] = first + i;
+	}
+}
+
+void SDSort::readEntry(uint16_t nr, Entry & entry)
+{
+	card.getfilename(nr);
+	const char * name = card.longFilename[0] ? card.longFilename : card.filename;
+
+	entry.is_dir = card.filenameIsDir;
+	entry.modified = card.getFileModified();
+	strncpy(entry.name, name, sizeof(entry.name) - 1);
+	entry.name[sizeof(entry.name) - 1] = '\0';
+}
+
+//! True if entry goes before the one card.getfilename() read last.
+bool SDSort::before(const Entry & entry)
+{
+	const char * name = card.longFilename[0] ? card.longFilename : card.filename;
+
+	if (entry.is_dir != card.filenameIsDir)
+	{
+		return entry.is_dir;
+	}
+#ifdef SD_SORT_BY_DATE
+	// Newest first
+	uint32_t modified = card.getFileModified();
+	if (entry.modified != modified)
+	{
+		return entry.modified > modified;
+	}
+#endif
+	return strcasecmp(entry.name, name) < 0;
+}
+
+#ifdef SD_SORT_INDEX_FILE
+//! Takes the order from the index file of the working folder if it was
+//! built for these entries.
+bool SDSort::loadIndex(uint16_t count, uint16_t signature)
+{
+	Header header;
+
+	if (!sort_file.open(&card.getWorkDir(), SD_SORT_INDEX_FILE, O_READ))
+	{
+		return false;
+	}
+	if (sort_file.read(&header, sizeof(header)) == sizeof(header)
+		&& header.magic == SD_SORT_MAGIC
+		&& header.count == count
+		&& header.signature == signature
+		&& header.region < 2)
+	{
+		sort_region = header.region;
+		return true;
+	}
+	sort_file.close();
+	return false;
+}
+
+//! Sorts runs of SD_SORT_ENTRIES entries in RAM into region 0 of the index
+//! file, then merges them from one region into the other, doubling the run
+//! length each pass. About count * log2(count) entry reads in all, done once
+//! per change of the folder. The header is completed last, so a file left
+//! half built is never used.
+bool SDSort::buildIndex(uint16_t count, uint16_t signature)
+{
+	// Don't write to the card while it is printing or receiving a file
+	if (card.sdprinting || card.saving)
+	{
+		return false;
+	}
+	if (!sort_file.open(&card.getWorkDir(), SD_SORT_INDEX_FILE, O_CREAT | O_RDWR | O_TRUNC))
+	{
+		return false;
+	}
+
+	Header header = { 0, count, signature, 0 };
+	bool done = (sort_file.write(&header, sizeof(header)) == sizeof(header));
+
+	for (uint16_t first = 0; done && first < count; first += SD_SORT_ENTRIES)
+	{
+		uint16_t length = min(count - first, SD_SORT_ENTRIES);
+		sortRun(first, length);
+		done = writeNumbers(0, first, length);
+	}
+
+	for (uint32_t width = SD_SORT_ENTRIES; done && width < count; width *= 2)
+	{
+		for (uint32_t low = 0; done && low < count; low += 2 * width)
+		{
+			done = mergeRuns(header.region, low, min(low + width, count), min(low + 2 * width, count));
+		}
+		header.region ^= 1;
+	}
+
+	if (done)
+	{
+		header.magic = SD_SORT_MAGIC;
+		done = sort_file.seekSet(0)
+			&& sort_file.write(&header, sizeof(header)) == sizeof(header)
+			&& sort_file.sync();
+	}
+	if (!done)
+	{
+		sort_file.close();
+		return false;
+	}
+
+	sort_region = header.region;
+	return true;
+}
+
+//! Merges the sorted runs [low, middle) and [middle, high) of region into
+//! the same place of the other region, through sort_order. Only the head
+//! of the first run is kept in RAM; the head of the second is read from
+//! the card for each comparison.
+bool SDSort::mergeRuns(uint8_t region, uint16_t low, uint16_t middle, uint16_t high)
+{
+	Entry entry;
+	bool entry_read = false;
+	uint16_t left = low;
+	uint16_t right = middle;
+	uint16_t left_nr = 0;
+	uint16_t right_nr = 0;
+	uint16_t buffered = 0;
+	uint16_t written = low;
+
+	if (left < middle && !readNumber(region, left, left_nr))
+	{
+		return false;
+	}
+	if (right < high && !readNumber(region, right, right_nr))
+	{
+		return false;
+	}
+
+	while (left < middle || right < high)
+	{
+		bool take_left = (right >= high);
+		if (left < middle && right < high)
+		{
+			if (!entry_read)
+			{
+				readEntry(left_nr, entry);
+				entry_read = true;
+			}
+			card.getfilename(right_nr);
+			// Names are unique in a folder, so no two entries compare equal
+			take_left = before(entry);
+		}
+
+		if (take_left)
+		{
+			sort_order[buffered++] = left_nr;
+			entry_read = false;
+			if (++left < middle && !readNumber(region, left, left_nr))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			sort_order[buffered++] = right_nr;
+			if (++right < high && !readNumber(region, right, right_nr))
+			{
+				return false;
+			}
+		}
+
+		if (buffered == SD_SORT_ENTRIES || (left >= middle && right >= high))
+		{
+			if (!writeNumbers(region ^ 1, written, buffered))
+			{
+				return false;
+			}
+			written += buffered;
+			buffered = 0;
+		}
+	}
+	return true;
+}
+
+uint32_t SDSort::numberPosition(uint8_t region, uint16_t index)
+{
+	return sizeof(Header) + ((uint32_t)region * sort_count + index) * sizeof(uint16_t);
+}
+
+bool SDSort::readNumber(uint8_t region, uint16_t index, uint16_t & nr)
+{
+	return sort_file.seekSet(numberPosition(region, index))
+		&& sort_file.read(&nr, sizeof(nr)) == sizeof(nr)
+		&& nr < sort_count;
+}
+
+//! Writes the first length numbers of sort_order from index on.
+bool SDSort::writeNumbers(uint8_t region, uint16_t index, uint16_t length)
+{
+	uint16_t size = length * sizeof(sort_order[0]);
+	return sort_file.seekSet(numberPosition(region, index))
+		&& sort_file.write(sort_order, size) == (int16_t)size;
+}
+#endif //SD_SORT_INDEX_FILE
+
+#endif //SD_SORT
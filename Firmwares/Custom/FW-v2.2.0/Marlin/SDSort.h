@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file SDSort.h
+///
+/// \brief Sorted order of the entries of the current SD folder.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef SD_SORT_H
+#define SD_SORT_H
+
+#include "cardreader.h"
+
+#ifdef SD_SORT
+
+#ifndef SD_SORT_ENTRIES
+	#define SD_SORT_ENTRIES 64
+#endif //SD_SORT_ENTRIES
+
+//! \brief Maps positions in the sorted list to the numbers getfilename()
+//! takes. Folders come first, then files, by name or newest first with
+//! SD_SORT_BY_DATE.
+//!
+//! The order of folders of up to SD_SORT_ENTRIES entries is kept in a
+//! static buffer, shared by the lists since only one is open at a time.
+//! It is kept until the folder changes, as told by the entry count and
+//! the signature getnrfilenames() leaves. Bigger folders keep the FAT order
+//! unless SD_SORT_INDEX_FILE is defined: then they are sorted in runs of
+//! SD_SORT_ENTRIES that are merged into that file inside the folder, and
+//! looked up from the card. Names are compared whole, reading the entries
+//! from the card as the order is built.
+class SDSort
+{
+	public:
+		SDSort();
+
+		void update(uint16_t count);
+		uint16_t order(uint16_t position);
+
+	private:
+		struct Entry
+		{
+			bool is_dir;
+			uint32_t modified;
+			char name[LONG_FILENAME_LENGTH];
+		};
+
+		static void sortRun(uint16_t first, uint16_t length);
+		static void readEntry(uint16_t nr, Entry & entry);
+		static bool before(const Entry & entry);
+
+#ifdef SD_SORT_INDEX_FILE
+		struct Header
+		{
+			uint16_t magic;
+			uint16_t count;
+			uint16_t signature;
+			uint16_t region;
+		};
+
+		static bool loadIndex(uint16_t count, uint16_t signature);
+		static bool buildIndex(uint16_t count, uint16_t signature);
+		static bool mergeRuns(uint8_t region, uint16_t low, uint16_t middle, uint16_t high);
+		static uint32_t numberPosition(uint8_t region, uint16_t index);
+		static bool readNumber(uint8_t region, uint16_t index, uint16_t & nr);
+		static bool writeNumbers(uint8_t region, uint16_t index, uint16_t length);
+#endif //SD_SORT_INDEX_FILE
+};
+
+#endif //SD_SORT
+#endif //SD_SORT_H
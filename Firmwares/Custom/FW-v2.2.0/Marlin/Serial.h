@@ -81,6 +81,7 @@
 #define MSG_SD_PRINTING_BYTE "SD printing byte "
 #define MSG_SD_NOT_PRINTING "Not SD printing"
 #define MSG_SD_ERR_WRITE_TO_FILE "error writing to file"
+#define MSG_SD_ERR_READ "SD read error"
 #define MSG_SD_CANT_ENTER_SUBDIR "Cannot enter subdir: "
 
 #define MSG_STEPPER_TOO_HIGH "Steprate too high: "
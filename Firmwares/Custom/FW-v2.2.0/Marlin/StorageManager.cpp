@@ -44,6 +44,7 @@ namespace eeprom
 	static uint8_t * const ADDR_SERIAL         = (uint8_t *) 503;
 	static uint8_t * const ADDR_LANGUAGE       = (uint8_t *) 504;
 	static uint8_t * const ADDR_BOX_FAN        = (uint8_t *) 505;
+	// 1024 to 3201 are kept by the print journal (PrintJournal.cpp)
 	static uint8_t * const ADDR_PROTECTED_ZONE = (uint8_t *) 4068;
 	static uint8_t * const ADDR_STAT_SUCCEDED  = (uint8_t *) 4069;
 	static uint8_t * const ADDR_STAT_FLAG      = (uint8_t *) 4071;
@@ -33,6 +33,7 @@
 #include "temperature.h"
 #include "Marlin.h"
 #include "cardreader.h"
+#include "PrintJournal.h"
 
 #ifdef DOGLCD
 	#include "GuiManager.h"
@@ -53,16 +54,17 @@ namespace temp
 #endif
 		, m_blower_control(true)
 	{
+#ifdef DOGLCD
+		// setTargetTemperature() writes through m_control.
+		m_control = new TemperatureControl();
+#endif
+
 		setTargetTemperature(0);
 		SET_OUTPUT(HEATER_0_PIN);
 #ifdef FAN_BLOCK_PIN
 		pinMode(FAN_BLOCK_PIN, OUTPUT);
 		digitalWrite(FAN_BLOCK_PIN, LOW);
 #endif //FAN_BLOCK_PIN
-
-#ifdef DOGLCD
-		m_control = new TemperatureControl();
-#endif
 	}
 
 	TemperatureManager::~TemperatureManager()
@@ -271,6 +273,18 @@ namespace temp
 	#else
 		manage_heater();
 	#endif
+
+	#ifdef REALTIME_COMMANDS
+		manage_realtime_commands();
+	#endif
+
+	#ifdef AUTO_REPORT_STATUS
+		manage_auto_report();
+	#endif
+
+	#ifdef PRINT_JOURNAL
+		PrintJournal::single::instance().update();
+	#endif
 	}
 }
 
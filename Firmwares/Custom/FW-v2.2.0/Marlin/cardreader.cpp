@@ -4,11 +4,21 @@
 #include "stepper.h"
 #include "temperature.h"
 #include "Serial.h"
+#include "PrintJournal.h"
+#include "TemperatureManager.h"
+
+#ifdef SD_FAST_UPLOAD
+  #include <util/crc16.h>
+#endif
 
 #ifdef DOGLCD
 #include "PrintManager.h"
 #endif // DOGLCD
 
+#if defined(SD_BENCHMARK) && defined(HOST_BUILD)
+  #include "Host.h"
+#endif
+
 #ifdef SDSUPPORT
 
 
@@ -21,6 +31,12 @@ CardReader::CardReader()
    cardOK = false;
    saving = false;
    logging = false;
+   readError = false;
+   #ifdef SD_FAST_UPLOAD
+     uploadBlock = NULL;
+     uploadLength = 0;
+     binaryUpload = false;
+   #endif
 
    autostart_atmillis=0;
    workDirDepth = 0;
@@ -40,6 +56,7 @@ CardReader::CardReader()
   autostart_atmillis=millis()+5000;
   
   newDir = true;
+  invalidateDirIndex();
 }
 
 char *createFilename(char *buffer,const dir_t &p) //buffer>12characters
@@ -82,7 +99,10 @@ void CardReader::lsDive(const char *prepend, SdFile parent, const char * const m
 	  curFolder = parent;
 	}
 
-  while (par->readDir(p, longFilename) > 0)
+  // entry_pos is where the entry just read (and its long name) starts
+  for (uint32_t entry_pos = par->curPosition();
+       par->readDir(p, longFilename) > 0;
+       entry_pos = par->curPosition())
   {
     if( DIR_IS_SUBDIR(&p) && lsAction!=LS_Count && lsAction!=LS_GetFilename) // hence LS_SerialPrint
     {
@@ -182,6 +202,13 @@ void CardReader::lsDive(const char *prepend, SdFile parent, const char * const m
       }
       else if(lsAction==LS_Count)
       {
+        #ifdef SD_DIR_INDEX_SIZE
+          addDirIndex(nrFiles, entry_pos);
+        #endif
+        #ifdef SD_SORT
+          dirSignature = (dirSignature << 3 | dirSignature >> 13) ^ p.lastWriteDate ^ p.lastWriteTime ^ (uint16_t)p.fileSize;
+          for (uint8_t i = 0; i < 11; i++) dirSignature += p.name[i];
+        #endif
         nrFiles++;
       } 
       else if(lsAction==LS_GetFilename)
@@ -214,6 +241,10 @@ void CardReader::ls()
 void CardReader::initsd()
 {
   newDir = true;
+  invalidateDirIndex();
+  #ifdef SD_LAYER_INDEX
+    layers.close();
+  #endif
   cardOK = false;
   if(root.isOpen())
     root.close();
@@ -270,6 +301,7 @@ void CardReader::setroot()
     SERIAL_ECHOLNPGM(MSG_SD_WORKDIR_FAIL);
   }*/
   workDir=root;
+  invalidateDirIndex();
   
   curDir=&workDir;
 }
@@ -284,6 +316,9 @@ void CardReader::startFileprint()
   if(cardOK)
   {
     sdprinting = true;
+    #ifdef PRINT_JOURNAL
+      PrintJournal::single::instance().start();
+    #endif
   }
 }
 
@@ -292,6 +327,9 @@ void CardReader::pauseSDPrint()
   if(sdprinting)
   {
     sdprinting = false;
+    #ifdef SD_LAYER_INDEX
+      layers.flush();
+    #endif
   }
 }
 
@@ -306,11 +344,16 @@ void CardReader::getAbsFilename(char *t)
 {
   uint8_t cnt=0;
   *t='/';t++;cnt++;
-  for(uint8_t i=0;i<workDirDepth;i++)
+  // workDirParents[0] is the parent of workDir and the last one the root,
+  // so the folders below the root are added from the end, then workDir.
+  for(uint8_t i=workDirDepth;i>0;i--)
   {
-    workDirParents[i].getFilename(t); //SDBaseFile.getfilename!
+    SdFile &dir = (i>1) ? workDirParents[i-2] : workDir;
+    dir.getFilename(t); //SDBaseFile.getfilename!
     while(*t!=0 && cnt< MAXPATHNAMELENGTH) 
     {t++;cnt++;}  //crawl counter forward.
+    if(cnt<MAXPATHNAMELENGTH-1)
+    {*t='/';t++;cnt++;}
   }
   if(cnt<MAXPATHNAMELENGTH-FILENAME_LENGTH)
     file.getFilename(t);
@@ -375,12 +418,12 @@ void CardReader::openFile(char* name,bool read, bool replace_current/*=true*/)
   if(name[0]=='/')
   {
     dirname_start=strchr(name,'/')+1;
-    while(dirname_start>0)
+    while(dirname_start!=NULL)
     {
       dirname_end=strchr(dirname_start,'/');
       //SERIAL_ECHO("start:");SERIAL_ECHOLN((int)(dirname_start-name));
       //SERIAL_ECHO("end  :");SERIAL_ECHOLN((int)(dirname_end-name));
-      if(dirname_end>0 && dirname_end>dirname_start)
+      if(dirname_end!=NULL && dirname_end>dirname_start)
       {
         char subdirname[FILENAME_LENGTH];
         strncpy(subdirname, dirname_start, dirname_end-dirname_start);
@@ -420,6 +463,26 @@ void CardReader::openFile(char* name,bool read, bool replace_current/*=true*/)
     if (file.open(curDir, fname, O_READ)) 
     {
       filesize = file.fileSize();
+      #ifdef SD_READ_AHEAD
+        read_ahead.invalidate();
+      #endif
+      #ifdef SD_CLUSTER_MAP
+        // Walk the FAT once now so the print never has to.
+        file.mapClusters(&cluster_map);
+      #endif
+      #ifdef SD_LAYER_INDEX
+        layers.open(curDir, &file);
+      #endif
+      #ifdef PRINT_JOURNAL
+        if(name[0]=='/')
+          PrintJournal::single::instance().select(name);
+        else
+        {
+          char path[MAXPATHNAMELENGTH];
+          getAbsFilename(path);
+          PrintJournal::single::instance().select(path);
+        }
+      #endif
       SERIAL_PROTOCOLPGM(MSG_SD_FILE_OPENED);
       SERIAL_PROTOCOL(fname);
       SERIAL_PROTOCOLPGM(MSG_SD_SIZE);
@@ -448,6 +511,20 @@ void CardReader::openFile(char* name,bool read, bool replace_current/*=true*/)
     else
     {
       saving = true;
+      invalidateDirIndex(); // the new file may take a free slot in the listing
+      #ifdef SD_FAST_UPLOAD
+        // A log is still written line by line. Without memory for the
+        // block an upload is too.
+        if(!logging && uploadBlock == NULL)
+          uploadBlock = new uint8_t[SD_UPLOAD_BLOCK];
+        uploadLength = 0;
+      #endif
+      #ifdef SD_CLUSTER_MAP
+        cluster_map.clear(); // the chain grows while writing
+      #endif
+      #ifdef SD_LAYER_INDEX
+        layers.close();
+      #endif
       SERIAL_PROTOCOLPGM(MSG_SD_WRITE_TO_FILE);
       SERIAL_PROTOCOLLN(name);
       lcd_setstatus(fname);
@@ -461,6 +538,9 @@ void CardReader::removeFile(char* name)
   if(!cardOK)
     return;
   file.close();
+  #ifdef SD_LAYER_INDEX
+    layers.close();
+  #endif
   sdprinting = false;
   
   
@@ -472,12 +552,12 @@ void CardReader::removeFile(char* name)
   if(name[0]=='/')
   {
     dirname_start=strchr(name,'/')+1;
-    while(dirname_start>0)
+    while(dirname_start!=NULL)
     {
       dirname_end=strchr(dirname_start,'/');
       //SERIAL_ECHO("start:");SERIAL_ECHOLN((int)(dirname_start-name));
       //SERIAL_ECHO("end  :");SERIAL_ECHOLN((int)(dirname_end-name));
-      if(dirname_end>0 && dirname_end>dirname_start)
+      if(dirname_end!=NULL && dirname_end>dirname_start)
       {
         char subdirname[FILENAME_LENGTH];
         strncpy(subdirname, dirname_start, dirname_end-dirname_start);
@@ -517,6 +597,7 @@ void CardReader::removeFile(char* name)
       SERIAL_PROTOCOLPGM("File deleted:");
       SERIAL_PROTOCOLLN(fname);
       sdpos = 0;
+      invalidateDirIndex();
     }
     else
     {
@@ -539,6 +620,81 @@ void CardReader::getStatus()
     SERIAL_PROTOCOLLNPGM(MSG_SD_NOT_PRINTING);
   }
 }
+// Copies the next command of the open file into buf, without its comment.
+// The bytes are scanned in the SD block cache (or the read-ahead buffer),
+// so a whole line costs one position update per block instead of a file
+// read per character.
+// A command ends at a newline, at '#' or ':' outside a comment, at the
+// end of the file or when buf is full. '#' also sets stop_buffering so
+// procedural macro calls can run before more of the file is queued.
+// Returns the length of the command, 0 for empty or comment-only lines.
+int16_t CardReader::getLine(char *buf, uint8_t size, bool &stop_buffering)
+{
+  uint8_t count = 0;
+  bool comment = false;
+  bool end_of_line = false;
+
+  while(!end_of_line)
+  {
+    const uint8_t *data;
+    uint32_t cluster;
+    #ifdef SD_CLUSTER_MAP
+      const SdExtentMap *map = &cluster_map;
+    #else
+      const SdExtentMap *map = NULL;
+    #endif
+    #ifdef SD_READ_AHEAD
+      int16_t n = file.readAhead(&read_ahead, &data, &cluster, map);
+    #else
+      int16_t n = file.readCached(&data, &cluster, map);
+    #endif
+    if(n < 0)
+    {
+      // Back to the start of the line, so resuming the print reads it
+      // again. The caller reports the error and stops reading.
+      readError = true;
+      #ifdef SD_CLUSTER_MAP
+        file.seekSet(sdpos, &cluster_map);
+      #else
+        file.seekSet(sdpos);
+      #endif
+      buf[0] = 0;
+      return 0;
+    }
+    if(n == 0) break; // end of file
+
+    int16_t used = 0;
+    while(used < n)
+    {
+      char c = data[used];
+      if(c == '\n' || c == '\r' || (!comment && (c == '#' || c == ':')))
+      {
+        if(c == '#') stop_buffering = true;
+        end_of_line = true;
+        used++;
+        break;
+      }
+      if(c == ';') comment = true;
+      if(!comment)
+      {
+        if(count >= size - 1)
+        {
+          // Too long: the rest becomes the next command.
+          end_of_line = true;
+          break;
+        }
+        buf[count++] = c;
+      }
+      used++;
+    }
+    file.skipCached(used, cluster);
+  }
+
+  buf[count] = 0;
+  sdpos = file.curPosition();
+  return count;
+}
+
 void CardReader::write_command(char *buf)
 {
   char* begin = buf;
@@ -554,7 +710,11 @@ void CardReader::write_command(char *buf)
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
-  file.write(begin);
+  #ifdef SD_FAST_UPLOAD
+    writeUpload((const uint8_t *)begin, strlen(begin));
+  #else
+    file.write(begin);
+  #endif
   if (file.writeError)
   {
     SERIAL_ERROR_START;
@@ -562,6 +722,390 @@ void CardReader::write_command(char *buf)
   }
 }
 
+#ifdef SD_FAST_UPLOAD
+enum UploadFrameState
+{
+  FRAME_SEQUENCE,
+  FRAME_LENGTH_LOW,
+  FRAME_LENGTH_HIGH,
+  FRAME_DATA,
+  FRAME_CRC_LOW,
+  FRAME_CRC_HIGH,
+  FRAME_DISCARD     // bad frame, waiting for the line to go quiet
+};
+
+//! Adds data to the block being gathered and writes the block once it is
+//! full. The upload starts a new file, so blocks fall on block boundaries
+//! and go to the card without passing through the cache of SdFat.
+void CardReader::writeUpload(const uint8_t *data, uint16_t length)
+{
+  if(uploadBlock == NULL)
+  {
+    file.write(data, length);
+    return;
+  }
+
+  while(length > 0)
+  {
+    uint16_t n = min(length, (uint16_t)(SD_UPLOAD_BLOCK - uploadLength));
+    memcpy(uploadBlock + uploadLength, data, n);
+    uploadLength += n;
+    data += n;
+    length -= n;
+    if(uploadLength == SD_UPLOAD_BLOCK)
+      flushUpload();
+  }
+}
+
+bool CardReader::flushUpload()
+{
+  if(uploadBlock == NULL || uploadLength == 0)
+    return true;
+
+  bool success = file.write(uploadBlock, uploadLength) == (int16_t)uploadLength;
+  uploadLength = 0;
+  return success;
+}
+
+//! Writes what is left of the upload and frees the block.
+void CardReader::endUpload()
+{
+  binaryUpload = false;
+#ifdef REALTIME_COMMANDS
+  rt_paused = false;
+#endif
+  if(uploadBlock == NULL)
+    return;
+
+  if(!flushUpload())
+  {
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM(MSG_SD_ERR_WRITE_TO_FILE);
+  }
+  delete[] uploadBlock;
+  uploadBlock = NULL;
+}
+
+//! Switches the port to binary frames for the file M28 just opened. A
+//! frame is its sequence number (1 byte, counting from 0 and wrapping),
+//! its length (2 bytes, up to SD_UPLOAD_BLOCK), the data and the
+//! CRC-16/XMODEM of all of them (2 bytes), little endian. Each frame is
+//! answered with "ok" once stored or "rs" to send it again. A frame sent
+//! again because its "ok" got lost is answered "ok" and not stored twice.
+//! An empty frame ends the upload. Realtime commands (M112 included) are
+//! off until it ends. See scripts/sd_upload.py.
+bool CardReader::startBinaryUpload()
+{
+  if(!saving || uploadBlock == NULL)
+    return false;
+
+  binaryUpload = true;
+#ifdef REALTIME_COMMANDS
+  // Frame bytes would be taken for realtime commands
+  rt_paused = true;
+#endif
+  file.writeError = false;
+  frameState = FRAME_SEQUENCE;
+  frameSequence = 0;
+  frameMillis = millis();
+  return true;
+}
+
+//! Runs instead of get_command() during a binary upload. Once a frame
+//! starts it is read to the end here, so the rest of the loop can't let
+//! the receive buffer overflow while the host streams it.
+void CardReader::receiveBinaryUpload()
+{
+  if(MYSERIAL.available() == 0)
+  {
+    if(millis() - frameMillis > SD_UPLOAD_IDLE_TIMEOUT)
+    {
+      // The host went away, give the port back to G-code
+      closefile();
+      SERIAL_ERROR_START;
+      SERIAL_ERRORLNPGM("Binary upload timed out");
+    }
+    return;
+  }
+
+  while(true)
+  {
+    if(MYSERIAL.available() == 0)
+    {
+      if(millis() - frameMillis > SD_UPLOAD_FRAME_TIMEOUT)
+      {
+        // A byte got lost or the frame was bad
+        endFrame(false);
+        return;
+      }
+      temp::TemperatureManager::single::instance().manageTemperatureControl();
+      continue;
+    }
+
+    uint8_t c = MYSERIAL.read();
+    frameMillis = millis();
+
+    switch(frameState)
+    {
+      case FRAME_SEQUENCE:
+        frameReceivedSequence = c;
+        frameCrc = _crc_xmodem_update(0, c);
+        frameState = FRAME_LENGTH_LOW;
+        break;
+
+      case FRAME_LENGTH_LOW:
+        frameLength = c;
+        frameCrc = _crc_xmodem_update(frameCrc, c);
+        frameState = FRAME_LENGTH_HIGH;
+        break;
+
+      case FRAME_LENGTH_HIGH:
+        frameLength |= (uint16_t)c << 8;
+        frameCrc = _crc_xmodem_update(frameCrc, c);
+        frameReceived = 0;
+        if(frameLength > SD_UPLOAD_BLOCK)
+        {
+          frameState = FRAME_DISCARD;
+          break;
+        }
+        if(uploadLength + frameLength > SD_UPLOAD_BLOCK)
+          flushUpload();
+        frameState = (frameLength > 0) ? FRAME_DATA : FRAME_CRC_LOW;
+        break;
+
+      case FRAME_DATA:
+        uploadBlock[uploadLength + frameReceived] = c;
+        frameCrc = _crc_xmodem_update(frameCrc, c);
+        if(++frameReceived == frameLength)
+          frameState = FRAME_CRC_LOW;
+        break;
+
+      case FRAME_CRC_LOW:
+        frameCrc ^= c;
+        frameState = FRAME_CRC_HIGH;
+        break;
+
+      case FRAME_CRC_HIGH:
+        frameCrc ^= (uint16_t)c << 8;
+        if(frameCrc == 0)
+        {
+          endFrame(true);
+          return;
+        }
+        frameState = FRAME_DISCARD;
+        break;
+
+      default:
+        break;
+    }
+  }
+}
+
+void CardReader::endFrame(bool valid)
+{
+  frameState = FRAME_SEQUENCE;
+  frameMillis = millis();
+
+  if(!valid)
+  {
+    // What the frame left past uploadLength is overwritten by the resend
+    SERIAL_PROTOCOLLNPGM("rs");
+    return;
+  }
+
+  if(frameReceivedSequence == (uint8_t)(frameSequence - 1))
+  {
+    // The last frame again, the host lost its "ok"
+    SERIAL_PROTOCOLLNPGM(MSG_OK);
+    return;
+  }
+
+  if(frameReceivedSequence != frameSequence)
+  {
+    closefile();
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM("Binary upload out of sequence");
+    return;
+  }
+  frameSequence++;
+
+  if(frameLength == 0)
+  {
+    closefile();
+    SERIAL_PROTOCOLLNPGM(MSG_FILE_SAVED);
+    SERIAL_PROTOCOLLNPGM(MSG_OK);
+    return;
+  }
+
+  uploadLength += frameLength;
+  if(uploadLength == SD_UPLOAD_BLOCK)
+    flushUpload();
+
+  if(file.writeError)
+  {
+    closefile();
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM(MSG_SD_ERR_WRITE_TO_FILE);
+    return;
+  }
+  SERIAL_PROTOCOLLNPGM(MSG_OK);
+}
+#endif //SD_FAST_UPLOAD
+
+#ifdef SD_BENCHMARK
+// Scratch file of the write test, removed afterwards
+#define SD_BENCHMARK_FILE "BENCH.TMP"
+#define SD_BENCHMARK_WRITE 65536UL
+
+#ifdef HOST_BUILD
+// Host time when the current test started. The firmware's own work takes
+// no virtual time, so this is what tells its cost apart from the card's.
+static uint32_t benchmark_host_start;
+#endif
+
+//! Ends the line of one test of benchmark() with its time, and its rate
+//! if it moved bytes. With HOST_BUILD the commands and blocks of the disk
+//! image, the time the card took and the time the host took, with its
+//! rate, are added.
+void CardReader::benchmarkResult(uint32_t bytes, unsigned long ms)
+{
+  SERIAL_ECHOPGM(", ");
+  SERIAL_ECHO(ms);
+  SERIAL_ECHOPGM(" ms");
+  if(bytes > 0 && ms > 0)
+  {
+    SERIAL_ECHOPGM(", ");
+    SERIAL_ECHO(bytes * 1000.0 / 1024 / ms);
+    SERIAL_ECHOPGM(" KB/s");
+  }
+  #ifdef HOST_BUILD
+    const Sd2Card::HostStats &stats = card.hostStats();
+    SERIAL_ECHOPGM(" (commands ");
+    SERIAL_ECHO(stats.commands);
+    SERIAL_ECHOPGM(", blocks read ");
+    SERIAL_ECHO(stats.blocksRead);
+    SERIAL_ECHOPGM(", written ");
+    SERIAL_ECHO(stats.blocksWritten);
+    SERIAL_ECHOPGM(", card ");
+    SERIAL_ECHO(stats.busyMicros / 1000);
+    SERIAL_ECHOPGM(" ms, host ");
+    uint32_t host_us = host_real_micros() - benchmark_host_start;
+    SERIAL_ECHO(host_us);
+    SERIAL_ECHOPGM(" us");
+    if(bytes > 0 && host_us > 0)
+    {
+      SERIAL_ECHOPGM(", ");
+      SERIAL_ECHO(bytes * 1000000.0 / 1024 / host_us);
+      SERIAL_ECHOPGM(" KB/s");
+    }
+    SERIAL_ECHOPGM(")");
+    card.clearHostStats();
+    benchmark_host_start = host_real_micros();
+  #endif
+  SERIAL_ECHOLN("");
+}
+
+//! Times what the printer does with the card: counting the entries of the
+//! working folder as the file list does, reading the file selected with
+//! M23 a command at a time as a print does and a character at a time as
+//! prints did before getLine(), and writing a scratch file a G-code line
+//! at a time. The selected file keeps its position.
+void CardReader::benchmark()
+{
+  if(!cardOK || sdprinting || saving)
+  {
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM("SD card busy or not ready");
+    return;
+  }
+
+  #ifdef HOST_BUILD
+    card.clearHostStats();
+    benchmark_host_start = host_real_micros();
+  #endif
+
+  // Directory listing, without the positions indexed by a previous one
+  invalidateDirIndex();
+  unsigned long start = millis();
+  uint16_t files = getnrfilenames();
+  unsigned long ms = millis() - start;
+  SERIAL_ECHO_START;
+  SERIAL_ECHOPGM("SD list: ");
+  SERIAL_ECHO(files);
+  SERIAL_ECHOPGM(" files");
+  benchmarkResult(0, ms);
+
+  // Print read path. setIndex() is not used so the layer index of the
+  // file still takes the next print as a continuous one.
+  if(isFileOpen())
+  {
+    char command[MAX_CMD_SIZE];
+    bool stop_buffering = false;
+    uint32_t position = sdpos;
+
+    file.seekSet(0);
+    sdpos = 0;
+    start = millis();
+    while(!eof() && !readError)
+      getLine(command, sizeof(command), stop_buffering);
+    ms = millis() - start;
+    if(readError)
+    {
+      readError = false;
+      SERIAL_ERROR_START;
+      SERIAL_ERRORLNPGM(MSG_SD_ERR_READ);
+    }
+    SERIAL_ECHO_START;
+    SERIAL_ECHOPGM("SD read: ");
+    SERIAL_ECHO(filesize);
+    SERIAL_ECHOPGM(" bytes");
+    benchmarkResult(filesize, ms);
+
+    // The same file through get(), one file read per character
+    file.seekSet(0);
+    sdpos = 0;
+    start = millis();
+    while(!eof() && get() >= 0)
+      ;
+    ms = millis() - start;
+    SERIAL_ECHO_START;
+    SERIAL_ECHOPGM("SD read by char: ");
+    SERIAL_ECHO(sdpos);
+    SERIAL_ECHOPGM(" bytes");
+    benchmarkResult(sdpos, ms);
+
+    sdpos = position;
+    #ifdef SD_CLUSTER_MAP
+      file.seekSet(position, &cluster_map);
+    #else
+      file.seekSet(position);
+    #endif
+  }
+
+  // Write path of an upload sent as G-code lines
+  SdFile scratch;
+  if(!scratch.open(&workDir, SD_BENCHMARK_FILE, O_CREAT | O_WRITE | O_TRUNC))
+  {
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM(MSG_SD_OPEN_FILE_FAIL SD_BENCHMARK_FILE);
+    return;
+  }
+  const char line[] = "G1 X100.000 Y100.000 E10.00000\r\n";
+  uint32_t written = 0;
+  start = millis();
+  while(written < SD_BENCHMARK_WRITE && scratch.write(line, sizeof(line) - 1) == (int16_t)(sizeof(line) - 1))
+    written += sizeof(line) - 1;
+  scratch.sync();
+  ms = millis() - start;
+  scratch.remove();
+  invalidateDirIndex();
+  SERIAL_ECHO_START;
+  SERIAL_ECHOPGM("SD write: ");
+  SERIAL_ECHO(written);
+  SERIAL_ECHOPGM(" bytes");
+  benchmarkResult(written, ms);
+}
+#endif //SD_BENCHMARK
 
 void CardReader::checkautostart(bool force)
 {
@@ -651,8 +1195,19 @@ bool CardReader::checkAutoFile()
 
 void CardReader::closefile(bool store_location)
 {
+  #ifdef SD_FAST_UPLOAD
+    endUpload();
+  #endif
   file.sync();
   file.close();
+  #ifdef SD_LAYER_INDEX
+    layers.close();
+  #endif
+  #ifdef PRINT_JOURNAL
+    // An upload ending must not drop the print the power cut
+    if(!saving)
+      PrintJournal::single::instance().stop();
+  #endif
   saving = false; 
   logging = false;
   
@@ -672,6 +1227,22 @@ void CardReader::getfilename(uint16_t nr, const char * const match/*=NULL*/)
   lsAction=LS_GetFilename;
   nrFiles=nr;
   curDir->rewind();
+  #ifdef SD_DIR_INDEX_SIZE
+    if(match == NULL && dirIndexCount > 0)
+    {
+      uint8_t i = min(nr / dirIndexStep, dirIndexCount - 1);
+      uint16_t indexed = i * dirIndexStep;
+      // Seek to the closest indexed entry unless reading on from the last
+      // one returned gets there sooner.
+      if(newDir || nr < count || count < indexed)
+      {
+        curFolder = *curDir;
+        curFolder.seekSet((uint32_t)dirIndex[i] << 5);
+        count = indexed;
+        newDir = false;
+      }
+    }
+  #endif
   lsDive("",*curDir,match);
   
 }
@@ -681,12 +1252,37 @@ uint16_t CardReader::getnrfilenames()
   curDir=&workDir;
   lsAction=LS_Count;
   nrFiles=0;
+  #ifdef SD_DIR_INDEX_SIZE
+    dirIndexCount = 0;
+    dirIndexStep = 1;
+  #endif
+  #ifdef SD_SORT
+    dirSignature = (uint16_t)(workDir.firstCluster() ^ workDir.firstCluster() >> 16);
+  #endif
   curDir->rewind();
   lsDive("",*curDir);
   //SERIAL_ECHOLN(nrFiles);
   return nrFiles;
 }
 
+#ifdef SD_DIR_INDEX_SIZE
+void CardReader::addDirIndex(uint16_t nr, uint32_t position)
+{
+  if(nr % dirIndexStep) return;
+  if(dirIndexCount == SD_DIR_INDEX_SIZE)
+  {
+    // Full: keep every other position and double the step, so any folder
+    // size fits in the same RAM at the cost of a longer read after a seek.
+    for(uint8_t i = 0; i < SD_DIR_INDEX_SIZE / 2; i++)
+      dirIndex[i] = dirIndex[2 * i];
+    dirIndexCount = SD_DIR_INDEX_SIZE / 2;
+    dirIndexStep *= 2;
+    if(nr % dirIndexStep) return;
+  }
+  dirIndex[dirIndexCount++] = position >> 5;
+}
+#endif // SD_DIR_INDEX_SIZE
+
 void CardReader::chdir(const char * relpath)
 {
   SdFile newfile;
@@ -720,6 +1316,7 @@ void CardReader::chdir(const char * relpath)
     }
     workDir=newfile;
     newDir = true;
+    invalidateDirIndex();
   }
 }
 
@@ -733,6 +1330,7 @@ void CardReader::updir()
     for (int d = 0; d < workDirDepth; d++)
       workDirParents[d] = workDirParents[d+1];
     newDir = true;
+    invalidateDirIndex();
   }
 }
 
@@ -751,6 +1349,13 @@ void CardReader::printingHasFinished()
     else
     {
       quickStop();
+      #ifdef SD_LAYER_INDEX
+        layers.finish();
+        layers.close();
+      #endif
+      #ifdef PRINT_JOURNAL
+        PrintJournal::single::instance().stop();
+      #endif
       file.close();
       sdprinting = false;
       if(SD_FINISHED_STEPPERRELEASE)
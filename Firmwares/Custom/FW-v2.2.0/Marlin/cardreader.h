@@ -9,7 +9,14 @@
 
 #define MAX_DIR_DEPTH 10
 
+#ifdef SD_FAST_UPLOAD
+  #define SD_UPLOAD_BLOCK 512
+  #define SD_UPLOAD_FRAME_TIMEOUT 200   // ms without a byte inside a binary frame
+  #define SD_UPLOAD_IDLE_TIMEOUT 10000  // ms without a frame before the upload is dropped
+#endif
+
 #include "SdFile.h"
+#include "LayerIndex.h"
 enum LsAction {LS_SerialPrint,LS_Count,LS_GetFilename};
 class CardReader
 {
@@ -18,6 +25,14 @@ public:
   
   void initsd();
   void write_command(char *buf);
+  #ifdef SD_FAST_UPLOAD
+    bool startBinaryUpload();
+    void receiveBinaryUpload();
+    FORCE_INLINE bool isBinaryUpload() { return binaryUpload; };
+  #endif
+  #ifdef SD_BENCHMARK
+    void benchmark();
+  #endif
   //files auto[0-9].g on the sd card are performed in a row
   //this is to delay autostart and hence the initialisaiton of the sd card to some seconds after the normal init, so the device is available quick after a reset
 
@@ -31,6 +46,7 @@ public:
   void startFileprint();
   void pauseSDPrint();
   void getStatus();
+  int16_t getLine(char *buf, uint8_t size, bool &stop_buffering);
   void printingHasFinished();
 
   void getfilename(uint16_t nr, const char* const match=NULL);
@@ -48,33 +64,99 @@ public:
   FORCE_INLINE bool isFileOpen() { return file.isOpen(); }
   FORCE_INLINE bool eof() { return sdpos>=filesize ;};
   FORCE_INLINE int16_t get() {  sdpos = file.curPosition();return (int16_t)file.read();};
-  FORCE_INLINE void setIndex(long index) {sdpos = index;file.seekSet(index);};
+  #ifdef SD_CLUSTER_MAP
+    FORCE_INLINE void setIndex(long index) {sdpos = index;file.seekSet(index, &cluster_map);layerJump();};
+  #else
+    FORCE_INLINE void setIndex(long index) {sdpos = index;file.seekSet(index);layerJump();};
+  #endif
+  FORCE_INLINE uint32_t getIndex() {return sdpos;};
   FORCE_INLINE uint8_t percentDone(){if(!isFileOpen()) return 0; if(filesize) return sdpos/((filesize+99)/100); else return 0;};
   FORCE_INLINE char* getWorkDirName(){workDir.getFilename(filename);return filename;};
   FORCE_INLINE char* getCurrentDirName(){curDir->getFilename(filename); return filename;};
-  FORCE_INLINE void reloadDir(){newDir=true;};
+  FORCE_INLINE void reloadDir(){newDir=true;invalidateDirIndex();};
   FORCE_INLINE bool isFileAtBegin() {if(isFileOpen()) return (sdpos==0); else return 0;};
+  #ifdef SD_SORT
+    FORCE_INLINE SdFile & getWorkDir() {return workDir;};
+    FORCE_INLINE uint16_t getDirSignature() {return dirSignature;};
+    FORCE_INLINE uint32_t getFileModified() {return ((uint32_t)p.lastWriteDate << 16) | p.lastWriteTime;};
+  #endif
 public:
   bool saving;
   bool logging;
   bool sdprinting;  
+  bool readError; // set by getLine(), cleared by whoever handles it
   bool cardOK;
   char filename[FILENAME_LENGTH];
   char longFilename[LONG_FILENAME_LENGTH];
   char folderName[LONG_FILENAME_LENGTH];
   bool filenameIsDir;
   int autostart_index;
+  #ifdef SD_LAYER_INDEX
+    LayerIndex layers; // layer index of the selected file
+  #endif
 private:
   bool newDir;
   SdFile curFolder;
   dir_t p;
-  uint8_t count;
+  uint16_t count;
+
+  #ifdef SD_DIR_INDEX_SIZE
+    // Directory position (in entries) of every dirIndexStep-th listed file
+    // of the working directory, filled by getnrfilenames() so getfilename()
+    // can seek close to any entry instead of reading from the start.
+    uint16_t dirIndex[SD_DIR_INDEX_SIZE];
+    uint8_t dirIndexCount;
+    uint16_t dirIndexStep;
+    void addDirIndex(uint16_t nr, uint32_t position);
+  #endif
+  #ifdef SD_SORT
+    // Checksum of the working directory and the entries getnrfilenames()
+    // counted in it, so a sorted order can tell if it is out of date.
+    uint16_t dirSignature;
+  #endif
+  FORCE_INLINE void layerJump() {
+    #ifdef SD_LAYER_INDEX
+      layers.jump();
+    #endif
+  };
+  #ifdef SD_FAST_UPLOAD
+    // Upload data is gathered here, allocated only while saving, so the
+    // card is written a whole block at a time.
+    uint8_t *uploadBlock;
+    uint16_t uploadLength;
+    bool binaryUpload;
+    uint8_t frameState;
+    uint8_t frameSequence;          // of the frame expected next
+    uint8_t frameReceivedSequence;
+    uint16_t frameLength;
+    uint16_t frameReceived;
+    uint16_t frameCrc;
+    unsigned long frameMillis;
+    void writeUpload(const uint8_t *data, uint16_t length);
+    bool flushUpload();
+    void endUpload();
+    void endFrame(bool valid);
+  #endif
+  #ifdef SD_BENCHMARK
+    void benchmarkResult(uint32_t bytes, unsigned long ms);
+  #endif
+  FORCE_INLINE void invalidateDirIndex() {
+    #ifdef SD_DIR_INDEX_SIZE
+      dirIndexCount = 0;
+    #endif
+  };
   
   SdFile root,*curDir,workDir,workDirParents[MAX_DIR_DEPTH];
   uint16_t workDirDepth;
   Sd2Card card;
   SdVolume volume;
   SdFile file;
+  #ifdef SD_READ_AHEAD
+    SdReadAheadBuffer read_ahead; // blocks of the file being printed
+  #endif
+  #ifdef SD_CLUSTER_MAP
+    SdExtentMap cluster_map; // cluster chain of the file being printed
+  #endif
   #define SD_PROCEDURE_DEPTH 1
   #define MAXPATHNAMELENGTH (FILENAME_LENGTH*MAX_DIR_DEPTH+MAX_DIR_DEPTH+1)
   uint8_t file_subcall_ctr;
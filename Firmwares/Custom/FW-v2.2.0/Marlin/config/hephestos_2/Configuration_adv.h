@@ -298,6 +298,88 @@
 // using:
 #define MENU_ADDAUTOSTART
 
+// Read the file being printed into its own 512 byte buffer, fetching
+// consecutive blocks with one multiple block read (CMD18) instead of a
+// command per block. FAT lookups no longer evict the block being printed.
+#define SD_READ_AHEAD
+
+// Map the cluster chain of the file to print when it is opened (a single
+// run for the usual contiguous file, up to 8 runs otherwise), so reading
+// and seeking need no FAT lookups during the print. Costs 69 bytes of RAM.
+#define SD_CLUSTER_MAP
+
+// Remember where every few entries of the current SD folder start, so the
+// file list can jump to any entry instead of reading the folder from the
+// start. Uses 2 bytes of RAM per slot; big folders share the slots.
+#define SD_DIR_INDEX_SIZE 32
+
+// Show the SD file list sorted, folders first. Folders of up to
+// SD_SORT_ENTRIES entries are sorted in RAM, 2 bytes per entry, and stay
+// sorted until the folder changes. Bigger ones are shown in FAT order
+// unless SD_SORT_INDEX_FILE is uncommented: then their order is kept in
+// that hidden file inside the folder, rebuilt only when the folder changes.
+// It is off by default since it writes to the card of the user. Uncomment
+// SD_SORT_BY_DATE to show the newest files first instead of sorting by name.
+#define SD_SORT
+//#define SD_SORT_BY_DATE
+#define SD_SORT_ENTRIES 64
+//#define SD_SORT_INDEX_FILE "_SORTIDX.BIN"
+
+// Keep an index of the layers of each printed file next to it (PART.GCO ->
+// PART.LYR), recorded while printing or made by scripts/layer_index.py.
+// M861 L<n> restores the state at the start of layer n, so M24 resumes the
+// print from there. Off by default: it writes a file to the card of the user
+// for every print.
+//#define SD_LAYER_INDEX
+
+// Checkpoints of SD prints in EEPROM, so a print the power cut can be
+// resumed with M862 R. A checkpoint is saved at each layer change, or
+// every PRINT_JOURNAL_INTERVAL seconds within a layer, and rotates
+// through 64 slots, so each slot is only rewritten every 64 checkpoints.
+#define PRINT_JOURNAL
+#define PRINT_JOURNAL_INTERVAL 30
+
+// M28 uploads are written to the card a whole 512 byte block at a time,
+// and M28 B1 <file> takes the file in CRC checked binary frames instead of
+// G-code lines (scripts/sd_upload.py). The block is only allocated while
+// a file is being uploaded.
+#define SD_FAST_UPLOAD
+
+// M863 times listing the working folder, reading the selected file and
+// writing a scratch file, to compare cards and SD code changes.
+//#define SD_BENCHMARK
+
+// The ST7920 display driver only sends the rows that changed since the
+// last frame instead of the whole screen on every redraw.
+#define ST7920_DIRTY_ROWS
+
+// Keep the whole screen in a 1 KB frame buffer instead of two pages of 512
+// bytes, so each screen runs its drawing code once per redraw instead of
+// once per page. Costs 512 bytes more of RAM.
+//#define ST7920_FULL_FRAMEBUFFER
+
+// Shortest time in ms between two frames of the heating and cooling
+// animations. They only repaint the progress bar and the temperature, when
+// it changes, once per frame.
+#define GUI_FRAME_MS 100
+
+// The display is redrawn at once on encoder or button input and when a new
+// screen is shown. Otherwise it is refreshed every GUI_REFRESH_MS, or later
+// if the last redraw would take more than GUI_LOOP_SHARE percent of the main
+// loop, and every GUI_REFRESH_LOW_MS while the planner is running out of
+// moves, so commands are read before the display is drawn.
+#define GUI_REFRESH_MS 50
+#define GUI_REFRESH_LOW_MS 500
+#define GUI_LOOP_SHARE 20
+
+// Time the redraws of the print screen. M864 prints how long they take,
+// M864 R resets the counters.
+//#define GUI_DRAW_STATS
+
+// M865 plays a script of encoder and button events on the display and
+// reports the redraw time, display bytes and memory of each step.
+//#define GUI_BENCHMARK
+
 // The hardware watchdog should reset the microcontroller disabling all outputs, in case the firmware gets stuck and doesn't do temperature regulation.
 //#define USE_WATCHDOG
 
@@ -396,6 +478,34 @@ const unsigned int dropsegments=5; //everything with less than this number of st
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 5
 
+// Transmission to the host is buffered in a ring drained by the USART data
+// register empty interrupt, so long responses don't stall loop().
+// TX_BUFFER_SIZE must be a power of 2 up to 128; 0 disables the buffer and
+// every byte busy-waits on the USART as before.
+#define TX_BUFFER_SIZE 32
+
+// By default write() waits for room when the TX buffer is full. Define this to
+// discard the outgoing byte instead (never blocks, but output may be lost).
+//#define TX_BUFFER_DROP_ON_OVERFLOW
+
+// Realtime commands are recognised by the serial RX interrupt and acted on at
+// once, however full the command queue is or whatever M109/M190 is waiting for:
+//  - M112 at the start of a line, or byte 0x18, stops the printer (kill()).
+//  - M108 at the start of a line, or byte 0x1B, stops waiting for the heaters.
+//  - Byte 0x05 reports temperatures and position; bytes 0xF5-0xF9 adjust
+//    the feedrate override (reset, +10%, -10%, +1%, -1%).
+#define REALTIME_COMMANDS
+
+// M155 S<seconds> makes the printer send its temperatures, in the format of
+// M105, on its own every S seconds, so hosts don't need to poll with M105.
+// M155 P1 adds the position to the line, as M114 reports it. S0 turns it off.
+#define AUTO_REPORT_STATUS
+
+// Keep call count, average and maximum execution time of the most relevant
+// G/M commands (see CommandStats.cpp). M860 prints them, M860 R resets them.
+// Costs about 250 bytes of RAM.
+//#define COMMAND_STATS
+
 
 // Firmware based and LCD controlled retract
 // M207 and M208 can be used to define parameters for the retraction.
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file Host.h
+///
+/// \brief Interfaces between the parts of the host build (HOST_BUILD).
+///
+/// HostCore.cpp emulates the ATmega2560: registers, timers, ADC, USART0,
+/// EEPROM and the virtual clock the firmware runs against. HostSerial.cpp
+/// connects USART0 to a pseudo-terminal or to stdin/stdout, and
+/// HostPrinter.cpp models the board around the chip: heaters, thermistors,
+/// endstops and the SD card slot. HostDisplay.cpp stands in for the ST7920
+/// graphic display.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_H
+#define HOST_H
+
+#include <stdint.h>
+
+// CPU cycles since reset, at F_CPU.
+extern uint64_t host_now;
+
+#define HOST_CYCLES_PER_US (F_CPU / 1000000UL)
+
+// Runs the clock forward, raising the interrupts that fall in between.
+void host_advance(uint64_t cycles);
+
+// Real time the host has taken since the start, in microseconds. The
+// firmware's own work takes no virtual time, so this is what times it.
+uint32_t host_real_micros(void);
+
+// Bytes in use on the heap. It holds host buffers as well, so only its
+// changes tell what the firmware takes.
+uint32_t host_heap_used(void);
+
+// Output level of a pin, or its PWM duty between 0 and 1 while a timer
+// drives it.
+float host_pin_duty(uint8_t pin);
+
+// Drives an input pin from the outside. Pins that nobody drives read high,
+// as with the pull-ups the firmware enables on its inputs.
+void host_pin_input(uint8_t pin, uint8_t level);
+
+// FAT16/FAT32 disk image in the SD card slot (--sd), or NULL for no card.
+extern const char * host_sd_image;
+
+// Set while the process waits on the host side, sleeping to keep up with
+// real time or for a full pseudo-terminal, so the stall monitor ignores it.
+extern volatile bool host_blocked;
+
+// Host side of the serial port (HostSerial.cpp).
+bool host_serial_open(bool use_stdio);
+bool host_serial_is_stdio(void);
+int host_serial_receive(void);
+void host_serial_transmit(uint8_t c);
+void host_serial_flush(void);
+
+// The board (HostPrinter.cpp).
+void host_printer_init(void);
+void host_printer_eeprom_defaults(uint8_t * data, uint16_t size);
+void host_printer_elapse(uint64_t cycles);
+uint16_t host_printer_adc(uint8_t channel);
+void host_printer_stepper_interrupt(void);
+
+// The graphic display (HostDisplay.cpp). host_display_receive() takes the
+// bytes the driver sends, host_display_dump() writes what the display shows
+// to <host_frames>/<frame>.pbm.
+extern const char * host_frames;
+void host_display_receive(uint8_t value);
+bool host_display_dump(uint16_t frame);
+
+// The firmware has commands received but not yet run (Marlin_main.cpp).
+bool host_commands_pending(void);
+
+#endif // HOST_H
@@ -0,0 +1,1315 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file HostCore.cpp
+///
+/// \brief ATmega2560 emulation for the host build (HOST_BUILD).
+///
+/// Timers, the ADC, USART0, the I/O ports, the EEPROM and the interrupt
+/// vectors, run against a virtual clock in CPU cycles. The clock moves
+/// when the firmware reads it or waits, and every interrupt that falls due
+/// on the way runs at its time, in the priority order of the chip.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "Arduino.h"
+#include <avr/eeprom.h>
+#include <avr/wdt.h>
+
+#include "fastio.h"
+#include "Host.h"
+
+static const uint64_t HOST_NEVER = ~0ULL;
+
+uint64_t host_now = 0;
+volatile bool host_blocked = false;
+
+// Options
+static uint32_t quantum = 10 * HOST_CYCLES_PER_US;
+static bool realtime = true;
+const char * host_sd_image = NULL;
+
+//===========================================================================
+// Registers
+//===========================================================================
+
+volatile uint8_t PINA, DDRA, PORTA, PINB, DDRB, PORTB, PINC, DDRC, PORTC;
+volatile uint8_t PIND, DDRD, PORTD, PINE, DDRE, PORTE, PINF, DDRF, PORTF;
+volatile uint8_t PING, DDRG, PORTG, PINH, DDRH, PORTH, PINJ, DDRJ, PORTJ;
+volatile uint8_t PINK, DDRK, PORTK, PINL, DDRL, PORTL;
+
+volatile uint8_t TCCR0A, TCCR0B, TIMSK0, TCNT0, OCR0A, OCR0B;
+volatile uint8_t TCCR2A, TCCR2B, TIMSK2, TCNT2, OCR2A, OCR2B, ASSR, GTCCR;
+volatile uint8_t TCCR1A, TCCR1B, TCCR1C, TIMSK1;
+volatile uint16_t TCNT1, OCR1A, OCR1B, OCR1C, ICR1;
+volatile uint8_t TCCR3A, TCCR3B, TCCR3C, TIMSK3;
+volatile uint16_t TCNT3, OCR3A, OCR3B, OCR3C, ICR3;
+volatile uint8_t TCCR4A, TCCR4B, TCCR4C, TIMSK4;
+volatile uint16_t TCNT4, OCR4A, OCR4B, OCR4C, ICR4;
+volatile uint8_t TCCR5A, TCCR5B, TCCR5C, TIMSK5;
+volatile uint16_t TCNT5, OCR5A, OCR5B, OCR5C, ICR5;
+
+volatile uint16_t ADC;
+volatile uint8_t ADCSRB, ADMUX, DIDR0, DIDR1, DIDR2, ACSR;
+
+volatile uint8_t UCSR0B, UCSR0C, UBRR0H, UBRR0L;
+volatile uint8_t UCSR1A, UCSR1B, UCSR1C, UBRR1H, UBRR1L, UDR1;
+volatile uint8_t UCSR2A, UCSR2B, UCSR2C, UBRR2H, UBRR2L, UDR2;
+volatile uint8_t UCSR3A, UCSR3B, UCSR3C, UBRR3H, UBRR3L, UDR3;
+
+volatile uint8_t SPCR;
+volatile uint8_t TWBR, TWSR, TWAR, TWDR, TWCR, TWAMR;
+volatile uint8_t EICRA, EICRB, EIMSK, EIFR, PCICR, PCIFR, PCMSK0, PCMSK1, PCMSK2;
+volatile uint8_t MCUSR, WDTCSR, SMCR, PRR0, PRR1, OSCCAL, CLKPR, EECR, EEDR;
+volatile uint16_t EEAR;
+
+static void sreg_write(HostIoRegister & reg, uint8_t value);
+static void adcsra_write(HostIoRegister & reg, uint8_t value);
+static void spsr_write(HostIoRegister & reg, uint8_t value);
+static void spdr_write(HostIoRegister & reg, uint8_t value);
+static void ucsr0a_write(HostIoRegister & reg, uint8_t value);
+static void udr0_write(HostIoRegister & reg, uint8_t value);
+static uint8_t udr0_read(HostIoRegister & reg);
+static void flag_write(HostIoRegister & reg, uint8_t value);
+
+HostIoRegister SREG = { 0, sreg_write, NULL };
+HostIoRegister ADCSRA = { 0, adcsra_write, NULL };
+HostIoRegister SPSR = { _BV(SPIF), spsr_write, NULL };
+HostIoRegister SPDR = { 0, spdr_write, NULL };
+HostIoRegister UCSR0A = { _BV(UDRE0), ucsr0a_write, NULL };
+HostIoRegister UDR0 = { 0, udr0_write, udr0_read };
+HostIoRegister TIFR0 = { 0, flag_write, NULL };
+HostIoRegister TIFR1 = { 0, flag_write, NULL };
+HostIoRegister TIFR2 = { 0, flag_write, NULL };
+HostIoRegister TIFR3 = { 0, flag_write, NULL };
+HostIoRegister TIFR4 = { 0, flag_write, NULL };
+HostIoRegister TIFR5 = { 0, flag_write, NULL };
+
+static void dispatch_interrupts();
+
+static void sreg_write(HostIoRegister & reg, uint8_t value)
+{
+	bool enabled = !(reg.value & _BV(SREG_I)) && (value & _BV(SREG_I));
+	reg.value = value;
+	if (enabled)
+	{
+		dispatch_interrupts();
+	}
+}
+
+static void flag_write(HostIoRegister & reg, uint8_t value)
+{
+	reg.value &= ~value;
+}
+
+static void spsr_write(HostIoRegister & reg, uint8_t value)
+{
+	reg.value = (value & _BV(SPI2X)) | _BV(SPIF);
+}
+
+static void spdr_write(HostIoRegister & reg, uint8_t value)
+{
+	reg.value = 0xFF;
+}
+
+//===========================================================================
+// Timers
+//===========================================================================
+
+enum TimerMode
+{
+	TIMER_NORMAL,
+	TIMER_CTC,
+	TIMER_FAST_PWM,
+	TIMER_PHASE_CORRECT,
+};
+
+struct HostTimer
+{
+	bool wide;
+	volatile uint8_t * tccra;
+	volatile uint8_t * tccrb;
+	volatile uint8_t * timsk;
+	HostIoRegister * tifr;
+	volatile void * tcnt;
+	volatile void * ocr[3];
+	volatile uint16_t * icr;
+
+	uint32_t count;
+	bool down;
+	uint32_t shadow;
+	uint64_t synced;
+	uint32_t frac;
+};
+
+#define HOST_TIMER8(n) { false, &TCCR##n##A, &TCCR##n##B, &TIMSK##n, &TIFR##n, &TCNT##n, { &OCR##n##A, &OCR##n##B, NULL }, NULL, 0, false, 0, 0, 0 }
+#define HOST_TIMER16(n) { true, &TCCR##n##A, &TCCR##n##B, &TIMSK##n, &TIFR##n, &TCNT##n, { &OCR##n##A, &OCR##n##B, &OCR##n##C }, &ICR##n, 0, false, 0, 0, 0 }
+
+static HostTimer timers[6] =
+{
+	HOST_TIMER8(0),
+	HOST_TIMER16(1),
+	HOST_TIMER8(2),
+	HOST_TIMER16(3),
+	HOST_TIMER16(4),
+	HOST_TIMER16(5),
+};
+
+static uint32_t timer_read(HostTimer const & t, volatile void * reg)
+{
+	return t.wide ? *(volatile uint16_t *) reg : *(volatile uint8_t *) reg;
+}
+
+static uint32_t timer_max(HostTimer const & t)
+{
+	return t.wide ? 0xFFFF : 0xFF;
+}
+
+static uint32_t timer_prescaler(HostTimer const & t)
+{
+	static const uint16_t prescalers[8] = { 0, 1, 8, 64, 256, 1024, 0, 0 };
+	static const uint16_t prescalers_timer2[8] = { 0, 1, 8, 32, 64, 128, 256, 1024 };
+
+	uint8_t cs = *t.tccrb & 0x07;
+	return (&t == &timers[2]) ? prescalers_timer2[cs] : prescalers[cs];
+}
+
+static TimerMode timer_mode(HostTimer const & t, uint32_t & top)
+{
+	uint32_t ocra = timer_read(t, t.ocr[0]);
+
+	if (!t.wide)
+	{
+		switch ((*t.tccra & 0x03) | ((*t.tccrb >> 1) & 0x04))
+		{
+			case 1: top = 0xFF; return TIMER_PHASE_CORRECT;
+			case 2: top = ocra; return TIMER_CTC;
+			case 3: top = 0xFF; return TIMER_FAST_PWM;
+			case 5: top = ocra; return TIMER_PHASE_CORRECT;
+			case 7: top = ocra; return TIMER_FAST_PWM;
+			default: top = 0xFF; return TIMER_NORMAL;
+		}
+	}
+
+	switch ((*t.tccra & 0x03) | ((*t.tccrb >> 1) & 0x0C))
+	{
+		case 1: top = 0x00FF; return TIMER_PHASE_CORRECT;
+		case 2: top = 0x01FF; return TIMER_PHASE_CORRECT;
+		case 3: top = 0x03FF; return TIMER_PHASE_CORRECT;
+		case 4: top = ocra; return TIMER_CTC;
+		case 5: top = 0x00FF; return TIMER_FAST_PWM;
+		case 6: top = 0x01FF; return TIMER_FAST_PWM;
+		case 7: top = 0x03FF; return TIMER_FAST_PWM;
+		case 8: top = *t.icr; return TIMER_PHASE_CORRECT;
+		case 9: top = ocra; return TIMER_PHASE_CORRECT;
+		case 10: top = *t.icr; return TIMER_PHASE_CORRECT;
+		case 11: top = ocra; return TIMER_PHASE_CORRECT;
+		case 12: top = *t.icr; return TIMER_CTC;
+		case 14: top = *t.icr; return TIMER_FAST_PWM;
+		case 15: top = ocra; return TIMER_FAST_PWM;
+		default: top = 0xFFFF; return TIMER_NORMAL;
+	}
+}
+
+// Ticks until a single slope counter at count next equals value, or 0 if
+// it never does. Past TOP the counter runs up to MAX before wrapping.
+static uint32_t ticks_until_single(uint32_t count, uint32_t value, uint32_t top, uint32_t max)
+{
+	if (count > top)
+	{
+		if (value > count) return value - count;
+		if (value <= top) return max - count + 1 + value;
+		return 0;
+	}
+	if (value > top) return 0;
+	if (value > count) return value - count;
+	return top - count + 1 + value;
+}
+
+// Same for a phase correct counter, at position 0 to 2 * TOP - 1 of its
+// up and down cycle.
+static uint32_t ticks_until_position(uint32_t position, uint32_t target, uint32_t period)
+{
+	return (target + period - position - 1) % period + 1;
+}
+
+// Ticks until the next enabled interrupt of the timer, and the flags that
+// it sets. 0 when no enabled interrupt is coming.
+static uint32_t timer_next_event(HostTimer const & t, uint8_t & flags)
+{
+	uint8_t enabled = *t.timsk & (_BV(TOIE1) | _BV(OCIE1A) | _BV(OCIE1B) | (t.wide ? _BV(OCIE1C) : 0));
+	flags = 0;
+	if (!enabled) return 0;
+
+	uint32_t top;
+	TimerMode mode = timer_mode(t, top);
+	uint32_t max = timer_max(t);
+	uint32_t count = t.count;
+	uint32_t best = 0;
+
+	uint32_t period = 2 * (top ? top : 1);
+	uint32_t position = t.down ? period - count : count;
+	if (mode == TIMER_PHASE_CORRECT && count > top)
+	{
+		position = top;
+	}
+
+	for (uint8_t bit = 0; bit < 4; bit++)
+	{
+		if (!(enabled & _BV(bit))) continue;
+
+		uint32_t ticks;
+		if (bit == TOV1)
+		{
+			switch (mode)
+			{
+				case TIMER_PHASE_CORRECT:
+					ticks = ticks_until_position(position, 0, period);
+					break;
+				case TIMER_CTC:
+					ticks = (count > top || top == max) ? max - count + 1 : 0;
+					break;
+				case TIMER_FAST_PWM:
+					ticks = (count > top) ? max - count + 1 : top - count + 1;
+					break;
+				default:
+					ticks = max - count + 1;
+					break;
+			}
+		}
+		else
+		{
+			uint32_t value = timer_read(t, t.ocr[bit - 1]);
+			if (mode == TIMER_PHASE_CORRECT)
+			{
+				if (value > top) continue;
+				ticks = ticks_until_position(position, value, period);
+				uint32_t down = ticks_until_position(position, period - value, period);
+				if (down < ticks) ticks = down;
+			}
+			else
+			{
+				ticks = ticks_until_single(count, value, (mode == TIMER_NORMAL) ? max : top, max);
+			}
+		}
+
+		if (ticks == 0) continue;
+		if (best == 0 || ticks < best)
+		{
+			best = ticks;
+			flags = 0;
+		}
+		if (ticks == best)
+		{
+			flags |= _BV(bit);
+		}
+	}
+	return best;
+}
+
+static void timer_step(HostTimer & t, uint64_t ticks)
+{
+	uint32_t top;
+	TimerMode mode = timer_mode(t, top);
+	uint32_t max = timer_max(t);
+
+	if (mode == TIMER_PHASE_CORRECT)
+	{
+		uint32_t period = 2 * (top ? top : 1);
+		uint32_t position = (t.count > top) ? top : (t.down ? period - t.count : t.count);
+		position = (position + ticks) % period;
+		t.down = position > top;
+		t.count = t.down ? period - position : position;
+		return;
+	}
+
+	if (mode == TIMER_NORMAL)
+	{
+		top = max;
+	}
+	if (t.count > top)
+	{
+		uint64_t to_wrap = max - t.count + 1;
+		if (ticks < to_wrap)
+		{
+			t.count += ticks;
+			return;
+		}
+		ticks -= to_wrap;
+		t.count = 0;
+	}
+	t.count = (t.count + ticks) % ((uint64_t) top + 1);
+}
+
+// Brings the counter up to time, setting the flags of the interrupts that
+// came due on the way.
+static void timer_sync(HostTimer & t, uint64_t time)
+{
+	uint32_t tcnt = timer_read(t, t.tcnt);
+	if (tcnt != t.shadow)
+	{
+		t.count = tcnt;
+		t.down = false;
+	}
+
+	uint32_t prescaler = timer_prescaler(t);
+	if (prescaler == 0 || time <= t.synced)
+	{
+		if (prescaler == 0) t.frac = 0;
+		if (time > t.synced) t.synced = time;
+	}
+	else
+	{
+		uint64_t elapsed = time - t.synced + t.frac;
+		uint64_t ticks = elapsed / prescaler;
+		t.frac = elapsed % prescaler;
+		t.synced = time;
+
+		while (ticks > 0)
+		{
+			uint8_t flags;
+			uint32_t next = timer_next_event(t, flags);
+			if (next == 0 || next > ticks)
+			{
+				timer_step(t, ticks);
+				break;
+			}
+			timer_step(t, next);
+			ticks -= next;
+			t.tifr->value |= flags;
+		}
+	}
+
+	if (t.wide)
+	{
+		*(volatile uint16_t *) t.tcnt = t.count;
+	}
+	else
+	{
+		*(volatile uint8_t *) t.tcnt = t.count;
+	}
+	t.shadow = t.count;
+}
+
+static uint64_t timer_next_time(HostTimer const & t)
+{
+	uint32_t prescaler = timer_prescaler(t);
+	if (prescaler == 0) return HOST_NEVER;
+
+	uint8_t flags;
+	uint32_t ticks = timer_next_event(t, flags);
+	if (ticks == 0) return HOST_NEVER;
+
+	return t.synced + (uint64_t) ticks * prescaler - t.frac;
+}
+
+//===========================================================================
+// ADC
+//===========================================================================
+
+// A conversion takes 13 ADC clocks and is sampled when it completes.
+static uint64_t adc_done = HOST_NEVER;
+
+static void adcsra_write(HostIoRegister & reg, uint8_t value)
+{
+	uint8_t flag = (value & _BV(ADIF)) ? 0 : (reg.value & _BV(ADIF));
+	bool busy = adc_done != HOST_NEVER;
+
+	reg.value = (value & ~_BV(ADIF)) | flag;
+
+	if (!(value & _BV(ADEN)))
+	{
+		adc_done = HOST_NEVER;
+		reg.value &= ~_BV(ADSC);
+	}
+	else if ((value & _BV(ADSC)) && !busy)
+	{
+		static const uint8_t prescalers[8] = { 2, 2, 4, 8, 16, 32, 64, 128 };
+		adc_done = host_now + 13UL * prescalers[value & 0x07];
+	}
+	else if (busy)
+	{
+		reg.value |= _BV(ADSC);
+	}
+}
+
+static void adc_complete()
+{
+	uint8_t channel = (ADMUX & 0x07) | ((ADCSRB & _BV(MUX5)) ? 0x08 : 0x00);
+
+	ADC = host_printer_adc(channel) & 0x3FF;
+	ADCSRA.value = (ADCSRA.value & ~_BV(ADSC)) | _BV(ADIF);
+	adc_done = HOST_NEVER;
+}
+
+//===========================================================================
+// USART0
+//===========================================================================
+
+// Next time a byte can arrive on the RX line.
+static uint64_t rx_next = 0;
+
+static uint64_t serial_byte_cycles()
+{
+	uint32_t ubrr = ((UBRR0H & 0x0F) << 8) | UBRR0L;
+	return 10ULL * ((UCSR0A.value & _BV(U2X0)) ? 8 : 16) * (ubrr + 1);
+}
+
+static void ucsr0a_write(HostIoRegister & reg, uint8_t value)
+{
+	uint8_t kept = reg.value & (_BV(RXC0) | _BV(UDRE0));
+	reg.value = kept | (value & (_BV(U2X0) | _BV(MPCM0)));
+}
+
+static void udr0_write(HostIoRegister & reg, uint8_t value)
+{
+	if (UCSR0B & _BV(TXEN0))
+	{
+		host_serial_transmit(value);
+	}
+}
+
+static uint8_t udr0_read(HostIoRegister & reg)
+{
+	UCSR0A.value &= ~_BV(RXC0);
+	return reg.value;
+}
+
+static void rx_event()
+{
+	rx_next = host_now + serial_byte_cycles();
+
+	if (!(UCSR0B & _BV(RXEN0))) return;
+
+	int c = host_serial_receive();
+	if (c < 0) return;
+
+	// A byte that lands on an unread one is lost, as on the chip.
+	if (!(UCSR0A.value & _BV(RXC0)))
+	{
+		UDR0.value = c;
+		UCSR0A.value |= _BV(RXC0);
+	}
+}
+
+//===========================================================================
+// Watchdog
+//===========================================================================
+
+static uint64_t wdt_timeout = 0;
+static uint64_t wdt_last_reset = 0;
+
+extern "C" void host_wdt_enable(uint8_t timeout)
+{
+	wdt_timeout = (F_CPU / 1000) * (15ULL << timeout);
+	wdt_last_reset = host_now;
+}
+
+extern "C" void host_wdt_disable(void)
+{
+	wdt_timeout = 0;
+}
+
+extern "C" void host_wdt_reset(void)
+{
+	wdt_last_reset = host_now;
+}
+
+static void watchdog_expired()
+{
+	host_serial_flush();
+	fprintf(stderr, "host: watchdog reset\n");
+	_exit(EXIT_SUCCESS);
+}
+
+//===========================================================================
+// Interrupts
+//===========================================================================
+
+#define HOST_VECTOR(name) extern "C" void name(void) __attribute__((weak));
+HOST_VECTOR(TIMER2_COMPA_vect)
+HOST_VECTOR(TIMER2_COMPB_vect)
+HOST_VECTOR(TIMER2_OVF_vect)
+HOST_VECTOR(TIMER1_COMPA_vect)
+HOST_VECTOR(TIMER1_COMPB_vect)
+HOST_VECTOR(TIMER1_COMPC_vect)
+HOST_VECTOR(TIMER1_OVF_vect)
+HOST_VECTOR(TIMER0_COMPA_vect)
+HOST_VECTOR(TIMER0_COMPB_vect)
+HOST_VECTOR(TIMER0_OVF_vect)
+HOST_VECTOR(USART0_RX_vect)
+HOST_VECTOR(USART0_UDRE_vect)
+HOST_VECTOR(ADC_vect)
+HOST_VECTOR(TIMER3_COMPA_vect)
+HOST_VECTOR(TIMER3_COMPB_vect)
+HOST_VECTOR(TIMER3_COMPC_vect)
+HOST_VECTOR(TIMER3_OVF_vect)
+HOST_VECTOR(TIMER4_COMPA_vect)
+HOST_VECTOR(TIMER4_COMPB_vect)
+HOST_VECTOR(TIMER4_COMPC_vect)
+HOST_VECTOR(TIMER4_OVF_vect)
+HOST_VECTOR(TIMER5_COMPA_vect)
+HOST_VECTOR(TIMER5_COMPB_vect)
+HOST_VECTOR(TIMER5_COMPC_vect)
+HOST_VECTOR(TIMER5_OVF_vect)
+
+struct HostVector
+{
+	HostIoRegister * flag_reg;
+	uint8_t flag;
+	volatile uint8_t * enable_reg;
+	uint8_t enable;
+	bool clear_flag;
+	void (*handler)(void);
+};
+
+// In the priority order of the vector table.
+static HostVector vectors[] =
+{
+	{ &TIFR2, _BV(OCF2A), &TIMSK2, _BV(OCIE2A), true, TIMER2_COMPA_vect },
+	{ &TIFR2, _BV(OCF2B), &TIMSK2, _BV(OCIE2B), true, TIMER2_COMPB_vect },
+	{ &TIFR2, _BV(TOV2), &TIMSK2, _BV(TOIE2), true, TIMER2_OVF_vect },
+	{ &TIFR1, _BV(OCF1A), &TIMSK1, _BV(OCIE1A), true, host_printer_stepper_interrupt },
+	{ &TIFR1, _BV(OCF1B), &TIMSK1, _BV(OCIE1B), true, TIMER1_COMPB_vect },
+	{ &TIFR1, _BV(OCF1C), &TIMSK1, _BV(OCIE1C), true, TIMER1_COMPC_vect },
+	{ &TIFR1, _BV(TOV1), &TIMSK1, _BV(TOIE1), true, TIMER1_OVF_vect },
+	{ &TIFR0, _BV(OCF0A), &TIMSK0, _BV(OCIE0A), true, TIMER0_COMPA_vect },
+	{ &TIFR0, _BV(OCF0B), &TIMSK0, _BV(OCIE0B), true, TIMER0_COMPB_vect },
+	{ &TIFR0, _BV(TOV0), &TIMSK0, _BV(TOIE0), true, TIMER0_OVF_vect },
+	{ &UCSR0A, _BV(RXC0), &UCSR0B, _BV(RXCIE0), false, USART0_RX_vect },
+	{ &UCSR0A, _BV(UDRE0), &UCSR0B, _BV(UDRIE0), false, USART0_UDRE_vect },
+	{ &ADCSRA, _BV(ADIF), (volatile uint8_t *) &ADCSRA.value, _BV(ADIE), true, ADC_vect },
+	{ &TIFR3, _BV(OCF3A), &TIMSK3, _BV(OCIE3A), true, TIMER3_COMPA_vect },
+	{ &TIFR3, _BV(OCF3B), &TIMSK3, _BV(OCIE3B), true, TIMER3_COMPB_vect },
+	{ &TIFR3, _BV(OCF3C), &TIMSK3, _BV(OCIE3C), true, TIMER3_COMPC_vect },
+	{ &TIFR3, _BV(TOV3), &TIMSK3, _BV(TOIE3), true, TIMER3_OVF_vect },
+	{ &TIFR4, _BV(OCF4A), &TIMSK4, _BV(OCIE4A), true, TIMER4_COMPA_vect },
+	{ &TIFR4, _BV(OCF4B), &TIMSK4, _BV(OCIE4B), true, TIMER4_COMPB_vect },
+	{ &TIFR4, _BV(OCF4C), &TIMSK4, _BV(OCIE4C), true, TIMER4_COMPC_vect },
+	{ &TIFR4, _BV(TOV4), &TIMSK4, _BV(TOIE4), true, TIMER4_OVF_vect },
+	{ &TIFR5, _BV(OCF5A), &TIMSK5, _BV(OCIE5A), true, TIMER5_COMPA_vect },
+	{ &TIFR5, _BV(OCF5B), &TIMSK5, _BV(OCIE5B), true, TIMER5_COMPB_vect },
+	{ &TIFR5, _BV(OCF5C), &TIMSK5, _BV(OCIE5C), true, TIMER5_COMPC_vect },
+	{ &TIFR5, _BV(TOV5), &TIMSK5, _BV(TOIE5), true, TIMER5_OVF_vect },
+};
+
+// Runs the pending interrupts while the I bit is set. Like the chip, an
+// interrupt runs with the I bit clear and sets it again when it returns.
+static void dispatch_interrupts()
+{
+	while (SREG.value & _BV(SREG_I))
+	{
+		HostVector * pending = NULL;
+		for (uint8_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++)
+		{
+			HostVector & v = vectors[i];
+			if ((v.flag_reg->value & v.flag) && (*v.enable_reg & v.enable))
+			{
+				if (v.clear_flag)
+				{
+					v.flag_reg->value &= ~v.flag;
+				}
+				else if (v.handler == NULL)
+				{
+					// A flag that only the handler would clear.
+					continue;
+				}
+				pending = &v;
+				break;
+			}
+		}
+		if (pending == NULL) return;
+		if (pending->handler == NULL) continue;
+
+		SREG.value &= ~_BV(SREG_I);
+		pending->handler();
+		SREG.value |= _BV(SREG_I);
+	}
+}
+
+//===========================================================================
+// Pins
+//===========================================================================
+
+struct HostPort
+{
+	volatile uint8_t * pin;
+	volatile uint8_t * ddr;
+	volatile uint8_t * port;
+	uint8_t driven;
+	uint8_t level;
+};
+
+static HostPort ports[] =
+{
+	{ &PINA, &DDRA, &PORTA, 0, 0 },
+	{ &PINB, &DDRB, &PORTB, 0, 0 },
+	{ &PINC, &DDRC, &PORTC, 0, 0 },
+	{ &PIND, &DDRD, &PORTD, 0, 0 },
+	{ &PINE, &DDRE, &PORTE, 0, 0 },
+	{ &PINF, &DDRF, &PORTF, 0, 0 },
+	{ &PING, &DDRG, &PORTG, 0, 0 },
+	{ &PINH, &DDRH, &PORTH, 0, 0 },
+	{ &PINJ, &DDRJ, &PORTJ, 0, 0 },
+	{ &PINK, &DDRK, &PORTK, 0, 0 },
+	{ &PINL, &DDRL, &PORTL, 0, 0 },
+};
+
+struct HostPin
+{
+	volatile uint8_t * pin;
+	uint8_t bit;
+};
+
+#define HOST_PIN(n) { &DIO##n##_RPORT, DIO##n##_PIN }
+static const HostPin pins[] =
+{
+	HOST_PIN(0), HOST_PIN(1), HOST_PIN(2), HOST_PIN(3), HOST_PIN(4), HOST_PIN(5),
+	HOST_PIN(6), HOST_PIN(7), HOST_PIN(8), HOST_PIN(9), HOST_PIN(10), HOST_PIN(11),
+	HOST_PIN(12), HOST_PIN(13), HOST_PIN(14), HOST_PIN(15), HOST_PIN(16), HOST_PIN(17),
+	HOST_PIN(18), HOST_PIN(19), HOST_PIN(20), HOST_PIN(21), HOST_PIN(22), HOST_PIN(23),
+	HOST_PIN(24), HOST_PIN(25), HOST_PIN(26), HOST_PIN(27), HOST_PIN(28), HOST_PIN(29),
+	HOST_PIN(30), HOST_PIN(31), HOST_PIN(32), HOST_PIN(33), HOST_PIN(34), HOST_PIN(35),
+	HOST_PIN(36), HOST_PIN(37), HOST_PIN(38), HOST_PIN(39), HOST_PIN(40), HOST_PIN(41),
+	HOST_PIN(42), HOST_PIN(43), HOST_PIN(44), HOST_PIN(45), HOST_PIN(46), HOST_PIN(47),
+	HOST_PIN(48), HOST_PIN(49), HOST_PIN(50), HOST_PIN(51), HOST_PIN(52), HOST_PIN(53),
+	HOST_PIN(54), HOST_PIN(55), HOST_PIN(56), HOST_PIN(57), HOST_PIN(58), HOST_PIN(59),
+	HOST_PIN(60), HOST_PIN(61), HOST_PIN(62), HOST_PIN(63), HOST_PIN(64), HOST_PIN(65),
+	HOST_PIN(66), HOST_PIN(67), HOST_PIN(68), HOST_PIN(69), HOST_PIN(70), HOST_PIN(71),
+	HOST_PIN(72), HOST_PIN(73), HOST_PIN(74), HOST_PIN(75), HOST_PIN(76), HOST_PIN(77),
+	HOST_PIN(78), HOST_PIN(79), HOST_PIN(80), HOST_PIN(81), HOST_PIN(82), HOST_PIN(83),
+	HOST_PIN(84), HOST_PIN(85),
+};
+
+static const uint8_t pin_count = sizeof(pins) / sizeof(pins[0]);
+
+// Output compare units and the pins they drive, for analogWrite().
+struct HostPwm
+{
+	uint8_t pin;
+	uint8_t timer;
+	uint8_t channel;
+};
+
+static const HostPwm pwm_pins[] =
+{
+	{ 2, 3, 1 }, { 3, 3, 2 }, { 4, 0, 1 }, { 5, 3, 0 }, { 6, 4, 0 },
+	{ 7, 4, 1 }, { 8, 4, 2 }, { 9, 2, 1 }, { 10, 2, 0 }, { 11, 1, 0 },
+	{ 12, 1, 1 }, { 13, 0, 0 }, { 44, 5, 2 }, { 45, 5, 1 }, { 46, 5, 0 },
+};
+
+static HostPort * port_of(uint8_t pin)
+{
+	for (uint8_t i = 0; i < sizeof(ports) / sizeof(ports[0]); i++)
+	{
+		if (ports[i].pin == pins[pin].pin) return &ports[i];
+	}
+	return NULL;
+}
+
+static HostPwm const * pwm_of(uint8_t pin)
+{
+	for (uint8_t i = 0; i < sizeof(pwm_pins) / sizeof(pwm_pins[0]); i++)
+	{
+		if (pwm_pins[i].pin == pin) return &pwm_pins[i];
+	}
+	return NULL;
+}
+
+// COMnx1 of the output compare unit.
+static uint8_t pwm_com_bit(HostPwm const * pwm)
+{
+	return _BV(7 - 2 * pwm->channel);
+}
+
+static void refresh_pins()
+{
+	for (uint8_t i = 0; i < sizeof(ports) / sizeof(ports[0]); i++)
+	{
+		HostPort & p = ports[i];
+		uint8_t inputs = (p.level & p.driven) | ~p.driven;
+		*p.pin = (*p.port & *p.ddr) | (inputs & ~*p.ddr);
+	}
+}
+
+void host_pin_input(uint8_t pin, uint8_t level)
+{
+	if (pin >= pin_count) return;
+
+	HostPort * p = port_of(pin);
+	uint8_t mask = _BV(pins[pin].bit);
+	p->driven |= mask;
+	if (level)
+	{
+		p->level |= mask;
+	}
+	else
+	{
+		p->level &= ~mask;
+	}
+	refresh_pins();
+}
+
+float host_pin_duty(uint8_t pin)
+{
+	if (pin >= pin_count) return 0;
+
+	HostPort * p = port_of(pin);
+	uint8_t mask = _BV(pins[pin].bit);
+	if (!(*p->ddr & mask)) return 0;
+
+	HostPwm const * pwm = pwm_of(pin);
+	if (pwm != NULL && (*timers[pwm->timer].tccra & pwm_com_bit(pwm)))
+	{
+		HostTimer const & t = timers[pwm->timer];
+		uint32_t top;
+		timer_mode(t, top);
+		uint32_t value = timer_read(t, t.ocr[pwm->channel]);
+		return (top == 0) ? 0 : (value >= top) ? 1 : (float) value / top;
+	}
+	return (*p->port & mask) ? 1 : 0;
+}
+
+//===========================================================================
+// Clock
+//===========================================================================
+
+static struct timespec start_time;
+static uint64_t paced_until = 0;
+
+static uint64_t real_cycles()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	uint64_t ns = (now.tv_sec - start_time.tv_sec) * 1000000000ULL + now.tv_nsec - start_time.tv_nsec;
+	return ns * HOST_CYCLES_PER_US / 1000;
+}
+
+uint32_t host_real_micros(void)
+{
+	return real_cycles() / HOST_CYCLES_PER_US;
+}
+
+// Keeps the virtual clock from running ahead of the real one.
+static void pace()
+{
+	if (host_now < paced_until + F_CPU / 1000) return;
+	paced_until = host_now;
+
+	uint64_t real = real_cycles();
+	if (host_now <= real) return;
+
+	uint64_t ns = (host_now - real) * 1000 / HOST_CYCLES_PER_US;
+	struct timespec delay = { (time_t)(ns / 1000000000ULL), (long)(ns % 1000000000ULL) };
+	host_blocked = true;
+	nanosleep(&delay, NULL);
+	host_blocked = false;
+}
+
+static volatile uint32_t activity = 0;
+
+static void move_to(uint64_t time)
+{
+	if (time > host_now)
+	{
+		host_printer_elapse(time - host_now);
+		host_now = time;
+	}
+}
+
+void host_advance(uint64_t cycles)
+{
+	uint64_t target = host_now + cycles;
+	activity++;
+
+	for (;;)
+	{
+		uint64_t next = HOST_NEVER;
+		for (uint8_t i = 0; i < 6; i++)
+		{
+			uint64_t t = timer_next_time(timers[i]);
+			if (t < next) next = t;
+		}
+		if (adc_done < next) next = adc_done;
+		if (rx_next < next) next = rx_next;
+
+		if (next > target) break;
+
+		// An interrupt may have run the clock past the next event already.
+		move_to(next);
+		for (uint8_t i = 0; i < 6; i++)
+		{
+			timer_sync(timers[i], host_now);
+		}
+		if (adc_done <= host_now)
+		{
+			adc_complete();
+		}
+		if (rx_next <= host_now)
+		{
+			rx_event();
+		}
+		refresh_pins();
+		dispatch_interrupts();
+	}
+
+	move_to(target);
+	for (uint8_t i = 0; i < 6; i++)
+	{
+		timer_sync(timers[i], host_now);
+	}
+	refresh_pins();
+
+	if (wdt_timeout && host_now - wdt_last_reset > wdt_timeout)
+	{
+		watchdog_expired();
+	}
+	if (realtime)
+	{
+		pace();
+	}
+}
+
+//===========================================================================
+// Arduino core
+//===========================================================================
+
+unsigned long millis(void)
+{
+	host_advance(quantum);
+	return host_now / (F_CPU / 1000);
+}
+
+unsigned long micros(void)
+{
+	host_advance(quantum);
+	return host_now / HOST_CYCLES_PER_US;
+}
+
+void delay(unsigned long ms)
+{
+	host_advance((uint64_t) ms * (F_CPU / 1000));
+}
+
+void delayMicroseconds(unsigned int us)
+{
+	host_advance((uint64_t) us * HOST_CYCLES_PER_US);
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+	if (pin >= pin_count) return;
+
+	HostPort * p = port_of(pin);
+	uint8_t mask = _BV(pins[pin].bit);
+	if (mode == OUTPUT)
+	{
+		*p->ddr |= mask;
+	}
+	else
+	{
+		*p->ddr &= ~mask;
+		if (mode == INPUT_PULLUP)
+		{
+			*p->port |= mask;
+		}
+		else
+		{
+			*p->port &= ~mask;
+		}
+	}
+	refresh_pins();
+}
+
+static void turn_off_pwm(uint8_t pin)
+{
+	HostPwm const * pwm = pwm_of(pin);
+	if (pwm != NULL)
+	{
+		*timers[pwm->timer].tccra &= ~pwm_com_bit(pwm);
+	}
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+	if (pin >= pin_count) return;
+
+	turn_off_pwm(pin);
+	HostPort * p = port_of(pin);
+	uint8_t mask = _BV(pins[pin].bit);
+	if (value == LOW)
+	{
+		*p->port &= ~mask;
+	}
+	else
+	{
+		*p->port |= mask;
+	}
+	refresh_pins();
+}
+
+int digitalRead(uint8_t pin)
+{
+	if (pin >= pin_count) return LOW;
+
+	turn_off_pwm(pin);
+	refresh_pins();
+	return (*pins[pin].pin & _BV(pins[pin].bit)) ? HIGH : LOW;
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+	pinMode(pin, OUTPUT);
+
+	HostPwm const * pwm = pwm_of(pin);
+	if (value <= 0 || value >= 255 || pwm == NULL)
+	{
+		digitalWrite(pin, (value < 128) ? LOW : HIGH);
+		return;
+	}
+
+	HostTimer & t = timers[pwm->timer];
+	*t.tccra |= pwm_com_bit(pwm);
+	if (t.wide)
+	{
+		*(volatile uint16_t *) t.ocr[pwm->channel] = value;
+	}
+	else
+	{
+		*(volatile uint8_t *) t.ocr[pwm->channel] = value;
+	}
+}
+
+void analogReference(uint8_t mode)
+{
+}
+
+int analogRead(uint8_t pin)
+{
+	if (pin >= 54) pin -= 54;
+
+	ADCSRB = (ADCSRB & ~_BV(MUX5)) | (((pin >> 3) & 0x01) << MUX5);
+	ADMUX = _BV(REFS0) | (pin & 0x07);
+	ADCSRA |= _BV(ADSC);
+	while (ADCSRA & _BV(ADSC))
+	{
+		host_advance(HOST_CYCLES_PER_US);
+	}
+	return ADC;
+}
+
+char * dtostrf(double value, signed char width, unsigned char precision, char * buffer)
+{
+	sprintf(buffer, "%*.*f", width, precision, value);
+	return buffer;
+}
+
+// The timer and ADC setup of the Arduino core's init().
+void init(void)
+{
+	TCCR0A = _BV(WGM01) | _BV(WGM00);
+	TCCR0B = _BV(CS01) | _BV(CS00);
+	TIMSK0 = _BV(TOIE0);
+
+	TCCR1B = _BV(CS11) | _BV(CS10);
+	TCCR1A = _BV(WGM10);
+	TCCR2B = _BV(CS22);
+	TCCR2A = _BV(WGM20);
+	TCCR3B = _BV(CS31) | _BV(CS30);
+	TCCR3A = _BV(WGM30);
+	TCCR4B = _BV(CS41) | _BV(CS40);
+	TCCR4A = _BV(WGM40);
+	TCCR5B = _BV(CS51) | _BV(CS50);
+	TCCR5A = _BV(WGM50);
+
+	ADCSRA = _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0) | _BV(ADEN);
+
+	UCSR0B = 0;
+
+	sei();
+}
+
+//===========================================================================
+// Heap
+//===========================================================================
+
+uint32_t host_heap_used(void)
+{
+	return mallinfo2().uordblks;
+}
+
+//===========================================================================
+// EEPROM
+//===========================================================================
+
+static uint8_t eeprom[E2END + 1];
+static int eeprom_fd = -1;
+
+static void eeprom_open(const char * path)
+{
+	eeprom_fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (eeprom_fd < 0)
+	{
+		fprintf(stderr, "host: %s: %s\n", path, strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+
+	memset(eeprom, 0xFF, sizeof(eeprom));
+	if (pread(eeprom_fd, eeprom, sizeof(eeprom), 0) != (ssize_t) sizeof(eeprom))
+	{
+		// A new file: an erased chip as it leaves the factory.
+		memset(eeprom, 0xFF, sizeof(eeprom));
+		host_printer_eeprom_defaults(eeprom, sizeof(eeprom));
+		if (pwrite(eeprom_fd, eeprom, sizeof(eeprom), 0) != (ssize_t) sizeof(eeprom))
+		{
+			fprintf(stderr, "host: %s: %s\n", path, strerror(errno));
+		}
+	}
+}
+
+static void eeprom_store(uintptr_t address, const void * data, size_t size)
+{
+	if (address >= sizeof(eeprom)) return;
+	if (size > sizeof(eeprom) - address) size = sizeof(eeprom) - address;
+
+	if (memcmp(&eeprom[address], data, size) == 0) return;
+	memcpy(&eeprom[address], data, size);
+	if (eeprom_fd >= 0 && pwrite(eeprom_fd, &eeprom[address], size, address) != (ssize_t) size)
+	{
+		fprintf(stderr, "host: EEPROM write failed: %s\n", strerror(errno));
+	}
+}
+
+static void eeprom_load(uintptr_t address, void * data, size_t size)
+{
+	memset(data, 0xFF, size);
+	if (address >= sizeof(eeprom)) return;
+	if (size > sizeof(eeprom) - address) size = sizeof(eeprom) - address;
+	memcpy(data, &eeprom[address], size);
+}
+
+extern "C" uint8_t eeprom_read_byte(const uint8_t * address)
+{
+	uint8_t value;
+	eeprom_load((uintptr_t) address, &value, sizeof(value));
+	return value;
+}
+
+extern "C" uint16_t eeprom_read_word(const uint16_t * address)
+{
+	uint16_t value;
+	eeprom_load((uintptr_t) address, &value, sizeof(value));
+	return value;
+}
+
+extern "C" uint32_t eeprom_read_dword(const uint32_t * address)
+{
+	uint32_t value;
+	eeprom_load((uintptr_t) address, &value, sizeof(value));
+	return value;
+}
+
+extern "C" float eeprom_read_float(const float * address)
+{
+	float value;
+	eeprom_load((uintptr_t) address, &value, sizeof(value));
+	return value;
+}
+
+extern "C" void eeprom_read_block(void * destination, const void * source, size_t size)
+{
+	eeprom_load((uintptr_t) source, destination, size);
+}
+
+extern "C" void eeprom_write_byte(uint8_t * address, uint8_t value)
+{
+	eeprom_store((uintptr_t) address, &value, sizeof(value));
+}
+
+extern "C" void eeprom_write_word(uint16_t * address, uint16_t value)
+{
+	eeprom_store((uintptr_t) address, &value, sizeof(value));
+}
+
+extern "C" void eeprom_write_dword(uint32_t * address, uint32_t value)
+{
+	eeprom_store((uintptr_t) address, &value, sizeof(value));
+}
+
+extern "C" void eeprom_write_float(float * address, float value)
+{
+	eeprom_store((uintptr_t) address, &value, sizeof(value));
+}
+
+extern "C" void eeprom_write_block(const void * source, void * destination, size_t size)
+{
+	eeprom_store((uintptr_t) destination, source, size);
+}
+
+extern "C" void eeprom_update_byte(uint8_t * address, uint8_t value)
+{
+	eeprom_store((uintptr_t) address, &value, sizeof(value));
+}
+
+extern "C" void eeprom_update_word(uint16_t * address, uint16_t value)
+{
+	eeprom_store((uintptr_t) address, &value, sizeof(value));
+}
+
+extern "C" void eeprom_update_dword(uint32_t * address, uint32_t value)
+{
+	eeprom_store((uintptr_t) address, &value, sizeof(value));
+}
+
+extern "C" void eeprom_update_float(float * address, float value)
+{
+	eeprom_store((uintptr_t) address, &value, sizeof(value));
+}
+
+extern "C" void eeprom_update_block(const void * source, void * destination, size_t size)
+{
+	eeprom_store((uintptr_t) destination, source, size);
+}
+
+//===========================================================================
+// Stall monitor
+//===========================================================================
+
+// kill() and the thermal runaway handler stop in a loop that never reads the
+// clock, and RESET() waits there for the watchdog. Time stands still then,
+// so a thread watches for a main loop that stopped making progress.
+static void * monitor(void * arg)
+{
+	uint32_t seen = activity;
+	uint8_t idle = 0;
+
+	for (;;)
+	{
+		usleep(250000);
+
+		uint32_t now = activity;
+		if (now != seen || host_blocked)
+		{
+			seen = now;
+			idle = 0;
+			continue;
+		}
+		if (++idle < 4) continue;
+
+		host_serial_flush();
+		if (wdt_timeout)
+		{
+			fprintf(stderr, "host: watchdog reset\n");
+			_exit(EXIT_SUCCESS);
+		}
+		fprintf(stderr, "host: the firmware stopped (kill() or a loop that never reads the clock)\n");
+		_exit(EXIT_FAILURE);
+	}
+	return NULL;
+}
+
+//===========================================================================
+// main
+//===========================================================================
+
+static void usage(const char * name)
+{
+	fprintf(stderr,
+		"Usage: %s [options]\n"
+		"  --stdio          read G-code from stdin and reply on stdout, exit once\n"
+		"                   everything has run (default: a pseudo-terminal)\n"
+		"  --eeprom FILE    EEPROM contents (default: eeprom.bin)\n"
+		"  --sd IMAGE       FAT16/FAT32 disk image in the SD card slot (default: none)\n"
+		"  --frames DIR     write the display frames of M865 to DIR as PBM images\n"
+		"  --realtime       keep the virtual clock at real time (pseudo-terminal default)\n"
+		"  --fast           run the virtual clock as fast as possible (--stdio default)\n"
+		"  --quantum US     time a millis() or micros() call takes (default: 10)\n",
+		name);
+}
+
+int main(int argc, char ** argv)
+{
+	static const struct option options[] =
+	{
+		{ "stdio", no_argument, NULL, 's' },
+		{ "eeprom", required_argument, NULL, 'e' },
+		{ "sd", required_argument, NULL, 'd' },
+		{ "frames", required_argument, NULL, 'g' },
+		{ "realtime", no_argument, NULL, 'r' },
+		{ "fast", no_argument, NULL, 'f' },
+		{ "quantum", required_argument, NULL, 'q' },
+		{ "help", no_argument, NULL, 'h' },
+		{ NULL, 0, NULL, 0 },
+	};
+
+	const char * eeprom_path = "eeprom.bin";
+	bool use_stdio = false;
+	int pacing = -1;
+	int option;
+
+	while ((option = getopt_long(argc, argv, "", options, NULL)) != -1)
+	{
+		switch (option)
+		{
+			case 's': use_stdio = true; break;
+			case 'e': eeprom_path = optarg; break;
+			case 'd': host_sd_image = optarg; break;
+			case 'g': host_frames = optarg; break;
+			case 'r': pacing = 1; break;
+			case 'f': pacing = 0; break;
+			case 'q': quantum = strtoul(optarg, NULL, 10) * HOST_CYCLES_PER_US; break;
+			default: usage(argv[0]); return (option == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+	if (quantum == 0)
+	{
+		quantum = 1;
+	}
+	realtime = (pacing < 0) ? !use_stdio : pacing;
+
+	clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+	eeprom_open(eeprom_path);
+	host_printer_init();
+	if (!host_serial_open(use_stdio))
+	{
+		return EXIT_FAILURE;
+	}
+	refresh_pins();
+	MCUSR = _BV(PORF);
+
+	pthread_t thread;
+	pthread_create(&thread, NULL, monitor, NULL);
+
+	init();
+	setup();
+	for (;;)
+	{
+		loop();
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file HostDisplay.cpp
+///
+/// \brief ST7920 graphic display for the host build (HOST_BUILD).
+///
+/// The driver hands over the bytes it would clock out on the soft-SPI, and
+/// they are decoded here into a copy of the display memory, so it holds
+/// what the display would show, partial redraws included. With --frames it
+/// can be written out as PBM images.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "Host.h"
+
+#include <stdio.h>
+
+const char * host_frames = NULL;
+
+static const uint8_t width = 128;
+static const uint8_t height = 64;
+
+// GDRAM as the display keeps it, a set bit is a black pixel.
+static uint8_t gdram[height][width / 8];
+
+// A sync byte (11111 RW RS 0) tells commands from data, then every byte
+// follows as two bytes holding a nibble each in their upper half.
+static uint8_t sync = 0;
+static uint8_t high = 0;
+static bool low_next = false;
+
+// The GDRAM address is set y first, then x in 16 pixel words. Words 8 and
+// up are the lower half of the screen.
+static bool x_next = false;
+static uint8_t y = 0;
+static uint8_t x = 0;                   // in bytes
+
+void host_display_receive(uint8_t value)
+{
+	if (value & 0x08)
+	{
+		sync = value;
+		low_next = false;
+		return;
+	}
+	if (!low_next)
+	{
+		high = value;
+		low_next = true;
+		return;
+	}
+	low_next = false;
+
+	uint8_t data = high | (value >> 4);
+	if (sync == 0xF8)
+	{
+		if (data & 0x80)
+		{
+			if (x_next)
+			{
+				x = 2 * (data & 0x0F);
+			}
+			else
+			{
+				y = data & 0x1F;
+			}
+			x_next = !x_next;
+		}
+		else
+		{
+			x_next = false;
+		}
+	}
+	else if (sync == 0xFA)
+	{
+		uint8_t row = y + ((x < width / 8) ? 0 : height / 2);
+		gdram[row][x % (width / 8)] = data;
+		x = (x + 1) % (2 * width / 8);
+	}
+}
+
+bool host_display_dump(uint16_t frame)
+{
+	if (host_frames == NULL) return false;
+
+	char path[256];
+	snprintf(path, sizeof(path), "%s/%03u.pbm", host_frames, frame);
+	FILE * file = fopen(path, "wb");
+	if (file == NULL)
+	{
+		fprintf(stderr, "host: can't write %s\n", path);
+		return false;
+	}
+	fprintf(file, "P4\n%u %u\n", width, height);
+	fwrite(gdram, 1, sizeof(gdram), file);
+	return fclose(file) == 0;
+}
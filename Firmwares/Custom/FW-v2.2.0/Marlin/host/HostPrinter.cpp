@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file HostPrinter.cpp
+///
+/// \brief The board around the chip, for the host build (HOST_BUILD).
+///
+/// Heaters that warm up and cool down with the power the firmware puts
+/// into them, thermistors that read back their temperature, carriages
+/// that move with the steps and trip the endstops, the card detect switch
+/// and the EEPROM as it leaves the factory.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <string.h>
+
+#include "Marlin.h"
+#include "planner.h"
+#include "stepper.h"
+#include "thermistortables.h"
+#include "StorageManager.h"
+#include "Host.h"
+
+extern volatile long count_position[NUM_AXIS];
+extern "C" void TIMER1_COMPA_vect(void);
+
+//===========================================================================
+// Heaters
+//===========================================================================
+
+static const float AMBIENT_TEMPERATURE = 25.0;
+
+// A heater with a lumped heat capacity, losing heat in proportion to its
+// temperature over ambient.
+struct HostHeater
+{
+	uint8_t pin;
+	float power;		// W
+	float capacity;		// J/K
+	float loss;			// W/K
+
+	float temperature;
+	uint64_t on_cycles;
+	uint64_t cycles;
+};
+
+static HostHeater hotend = { HEATER_0_PIN, 40.0, 10.0, 0.12, AMBIENT_TEMPERATURE, 0, 0 };
+
+#if defined(HEATER_BED_PIN) && HEATER_BED_PIN > -1 && defined(BEDTEMPTABLE)
+	#define HOST_HEATED_BED
+	static HostHeater bed = { HEATER_BED_PIN, 200.0, 300.0, 1.5, AMBIENT_TEMPERATURE, 0, 0 };
+#endif
+
+// Integrated a millisecond at a time, with the average power of the heater
+// over it.
+static void heater_elapse(HostHeater & heater, uint64_t cycles)
+{
+	heater.cycles += cycles;
+	heater.on_cycles += cycles * host_pin_duty(heater.pin);
+	if (heater.cycles < F_CPU / 1000) return;
+
+	float seconds = (float) heater.cycles / F_CPU;
+	float power = heater.power * heater.on_cycles / heater.cycles;
+	float target = AMBIENT_TEMPERATURE + power / heater.loss;
+
+	heater.temperature = target + (heater.temperature - target) * expf(-heater.loss * seconds / heater.capacity);
+	heater.cycles = 0;
+	heater.on_cycles = 0;
+}
+
+// ADC reading of a thermistor at the given temperature, from the table the
+// firmware converts it back with.
+static uint16_t thermistor_raw(const short (*table)[2], uint8_t length, float temperature)
+{
+	if (temperature >= table[0][1]) return table[0][0] / OVERSAMPLENR;
+
+	for (uint8_t i = 1; i < length; i++)
+	{
+		if (temperature >= table[i][1])
+		{
+			float fraction = (temperature - table[i][1]) / (table[i - 1][1] - table[i][1]);
+			float raw = table[i][0] + fraction * (table[i - 1][0] - table[i][0]);
+			return (uint16_t) (raw / OVERSAMPLENR + 0.5);
+		}
+	}
+	return table[length - 1][0] / OVERSAMPLENR;
+}
+
+//===========================================================================
+// Axes
+//===========================================================================
+
+// Where the carriage really is, in mm. It starts in the middle of each axis,
+// away from the endstops, as after switching the printer on.
+static float axis_position[3] =
+{
+	(X_MIN_POS + X_MAX_POS) / 2.0,
+	(Y_MIN_POS + Y_MAX_POS) / 2.0,
+	(Z_MIN_POS + Z_MAX_POS) / 2.0,
+};
+
+static void endstop_update(int8_t pin, bool triggered, bool inverting)
+{
+	if (pin > -1)
+	{
+		host_pin_input(pin, triggered != inverting);
+	}
+}
+
+static void endstops_update()
+{
+	endstop_update(X_MIN_PIN, axis_position[X_AXIS] <= X_MIN_POS, X_MIN_ENDSTOP_INVERTING);
+	endstop_update(X_MAX_PIN, axis_position[X_AXIS] >= X_MAX_POS, X_MAX_ENDSTOP_INVERTING);
+	endstop_update(Y_MIN_PIN, axis_position[Y_AXIS] <= Y_MIN_POS, Y_MIN_ENDSTOP_INVERTING);
+	endstop_update(Y_MAX_PIN, axis_position[Y_AXIS] >= Y_MAX_POS, Y_MAX_ENDSTOP_INVERTING);
+	endstop_update(Z_MIN_PIN, axis_position[Z_AXIS] <= Z_MIN_POS, Z_MIN_ENDSTOP_INVERTING);
+	endstop_update(Z_MAX_PIN, axis_position[Z_AXIS] >= Z_MAX_POS, Z_MAX_ENDSTOP_INVERTING);
+}
+
+// The steps the interrupt takes move the carriage. The firmware also sets
+// count_position when it redefines the coordinates, which moves nothing, so
+// only the change across the interrupt counts.
+void host_printer_stepper_interrupt(void)
+{
+	long before[3] = { count_position[X_AXIS], count_position[Y_AXIS], count_position[Z_AXIS] };
+
+	TIMER1_COMPA_vect();
+
+	bool moved = false;
+	for (uint8_t axis = X_AXIS; axis <= Z_AXIS; axis++)
+	{
+		long steps = count_position[axis] - before[axis];
+		if (steps != 0)
+		{
+			axis_position[axis] += steps / axis_steps_per_unit[axis];
+			moved = true;
+		}
+	}
+	if (moved)
+	{
+		endstops_update();
+	}
+}
+
+//===========================================================================
+// Board
+//===========================================================================
+
+void host_printer_init(void)
+{
+	endstops_update();
+
+#if SDCARDDETECT > -1
+	// A card in the slot if there is a disk image for it.
+	#ifdef SDCARDDETECTINVERTED
+		host_pin_input(SDCARDDETECT, host_sd_image != NULL);
+	#else
+		host_pin_input(SDCARDDETECT, host_sd_image == NULL);
+	#endif // SDCARDDETECTINVERTED
+#endif // SDCARDDETECT > -1
+}
+
+// The serial number written at the factory. Its second to fourth
+// characters are the board family, which setup() checks against
+// MOTHERBOARD.
+void host_printer_eeprom_defaults(uint8_t * data, uint16_t size)
+{
+	static const uint16_t serial_number = 4080;
+
+#if MOTHERBOARD == BOARD_BQ_CNC
+	memcpy(&data[serial_number], "0CNC000000000", 13);
+#elif MOTHERBOARD == BOARD_BQ_ZUM_MEGA_3D
+	memcpy(&data[serial_number], "0ZM3000000000", 13);
+#endif
+
+#ifdef DOGLCD
+	// Past the first power on wizard, with the serial screen on, so the
+	// printer takes prints from the serial port and the SD card at once.
+	static const uint16_t first_power_on = 500;
+	static const uint16_t serial_screen = 503;
+
+	data[first_power_on] = eeprom::INITIALIZED;
+	data[serial_screen] = eeprom::SERIAL_SCREEN_ON;
+
+	#ifdef BQ_EEPROM_VERSION
+		// The splash screen erases an EEPROM of any other layout.
+		static const uint16_t eeprom_version = 4072;
+		static const uint16_t eeprom_flag = 4073;
+
+		data[eeprom_version] = BQ_EEPROM_VERSION;
+		data[eeprom_flag] = eeprom::EEPROM_ENABLED;
+	#endif // BQ_EEPROM_VERSION
+#endif // DOGLCD
+}
+
+void host_printer_elapse(uint64_t cycles)
+{
+	heater_elapse(hotend, cycles);
+#ifdef HOST_HEATED_BED
+	heater_elapse(bed, cycles);
+#endif // HOST_HEATED_BED
+}
+
+uint16_t host_printer_adc(uint8_t channel)
+{
+	if (channel == TEMP_0_PIN)
+	{
+		return thermistor_raw(HEATER_0_TEMPTABLE, HEATER_0_TEMPTABLE_LEN, hotend.temperature);
+	}
+#ifdef HOST_HEATED_BED
+	if (channel == TEMP_BED_PIN)
+	{
+		return thermistor_raw(BEDTEMPTABLE, BEDTEMPTABLE_LEN, bed.temperature);
+	}
+#endif // HOST_HEATED_BED
+
+	// An open input.
+	return 1023;
+}
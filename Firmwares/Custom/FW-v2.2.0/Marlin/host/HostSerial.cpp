@@ -0,0 +1,216 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file HostSerial.cpp
+///
+/// \brief Host end of USART0 for the host build (HOST_BUILD).
+///
+/// By default the port is a pseudo-terminal that Printrun, OctoPrint or
+/// scripts/serial_benchmark.py connect to, and bytes arrive at the baud
+/// rate the firmware sets. With --stdio the G-code comes from stdin, held
+/// back while the firmware is busy, and the program exits once all of it
+/// has run.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "Marlin.h"
+#include "planner.h"
+#include "cardreader.h"
+#include "Host.h"
+
+// After SdBaseFile.h, whose O_* open flags share the names of the macros
+// in fcntl.h.
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+static bool stdio_mode = false;
+static int rx_fd = -1;
+static int tx_fd = -1;
+
+// Slave side of the pseudo-terminal. Kept open so reads don't fail with
+// EIO while no host program is connected, and output written before it
+// connects is kept, as a real port would do.
+static int pty_slave = -1;
+
+// Bytes read from the host side and not yet delivered to USART0.
+static uint8_t rx_data[256];
+static ssize_t rx_length = 0;
+static ssize_t rx_position = 0;
+static bool rx_closed = false;
+
+// Output is collected up to the end of the line so a whole reply goes out
+// in one system call.
+static uint8_t tx_data[96];
+static uint8_t tx_length = 0;
+
+// In --stdio mode, the time everything went idle after the end of the input.
+static uint64_t idle_since = 0;
+
+bool host_serial_open(bool use_stdio)
+{
+	stdio_mode = use_stdio;
+	if (stdio_mode)
+	{
+		rx_fd = STDIN_FILENO;
+		tx_fd = STDOUT_FILENO;
+		return true;
+	}
+
+	int master = posix_openpt(O_RDWR | O_NOCTTY);
+	if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+	{
+		perror("host: posix_openpt");
+		return false;
+	}
+	const char * name = ptsname(master);
+
+	pty_slave = open(name, O_RDWR | O_NOCTTY);
+	struct termios tio;
+	if (pty_slave >= 0 && tcgetattr(pty_slave, &tio) == 0)
+	{
+		cfmakeraw(&tio);
+		tcsetattr(pty_slave, TCSANOW, &tio);
+	}
+	fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+	rx_fd = tx_fd = master;
+	fprintf(stderr, "host: listening on %s\n", name);
+	return true;
+}
+
+bool host_serial_is_stdio(void)
+{
+	return stdio_mode;
+}
+
+static void fill()
+{
+	struct pollfd pfd = { rx_fd, POLLIN, 0 };
+	if (poll(&pfd, 1, 0) <= 0) return;
+
+	ssize_t received = read(rx_fd, rx_data, sizeof(rx_data));
+	if (received > 0)
+	{
+		rx_length = received;
+		rx_position = 0;
+	}
+	else if (received == 0 || (errno != EAGAIN && errno != EINTR))
+	{
+		rx_closed = true;
+	}
+}
+
+static bool idle()
+{
+	if (rx_buffer.head != rx_buffer.tail) return false;
+	if (host_commands_pending() || blocks_queued()) return false;
+#ifdef SDSUPPORT
+	if (card.sdprinting) return false;
+#endif // SDSUPPORT
+	return true;
+}
+
+// Called when the line has time for another byte. Returns the byte, or -1
+// when there is none.
+int host_serial_receive(void)
+{
+	if (rx_position == rx_length && !rx_closed)
+	{
+		fill();
+	}
+
+	if (rx_position < rx_length)
+	{
+		idle_since = 0;
+		if (stdio_mode)
+		{
+			// A file or a pipe can wait for the firmware: hold the byte back
+			// rather than overrun USART0 or rx_buffer.
+			int used = (RX_BUFFER_SIZE + rx_buffer.head - rx_buffer.tail) % RX_BUFFER_SIZE;
+			if ((UCSR0A & _BV(RXC0)) || used >= RX_BUFFER_SIZE - 1) return -1;
+		}
+		return rx_data[rx_position++];
+	}
+
+	if (stdio_mode && rx_closed)
+	{
+		// The input is over: exit once every command in it has run.
+		if (!idle())
+		{
+			idle_since = 0;
+		}
+		else if (idle_since == 0)
+		{
+			idle_since = host_now;
+		}
+		else if (host_now - idle_since > F_CPU / 100)
+		{
+			// _exit(): the firmware's globals were never meant to be
+			// destroyed.
+			host_serial_flush();
+			_exit(EXIT_SUCCESS);
+		}
+	}
+	return -1;
+}
+
+static void send(const uint8_t * data, size_t length)
+{
+	while (length > 0)
+	{
+		ssize_t sent = write(tx_fd, data, length);
+		if (sent > 0)
+		{
+			data += sent;
+			length -= sent;
+		}
+		else if (sent < 0 && errno == EAGAIN)
+		{
+			// The host is not reading: wait like a full TX buffer does.
+			struct pollfd pfd = { tx_fd, POLLOUT, 0 };
+			host_blocked = true;
+			poll(&pfd, 1, 10);
+			host_blocked = false;
+		}
+		else if (sent < 0 && errno != EINTR)
+		{
+			return;
+		}
+	}
+}
+
+void host_serial_transmit(uint8_t c)
+{
+	tx_data[tx_length++] = c;
+	if (c == '\n' || tx_length == sizeof(tx_data))
+	{
+		host_serial_flush();
+	}
+}
+
+void host_serial_flush(void)
+{
+	if (tx_length == 0 || tx_fd < 0) return;
+
+	send(tx_data, tx_length);
+	tx_length = 0;
+}
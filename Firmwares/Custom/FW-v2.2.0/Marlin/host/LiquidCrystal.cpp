@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file LiquidCrystal.cpp
+///
+/// \brief HD44780 character display for host builds.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include "LiquidCrystal.h"
+
+LiquidCrystal::LiquidCrystal(uint8_t rs, uint8_t enable, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7)
+  : m_cols(20)
+  , m_rows(4)
+  , m_col(0)
+  , m_row(0)
+{
+  memset(m_text, ' ', sizeof(m_text));
+}
+
+void LiquidCrystal::begin(uint8_t cols, uint8_t rows, uint8_t charsize)
+{
+  m_cols = (cols < 20) ? cols : 20;
+  m_rows = (rows < 4) ? rows : 4;
+  clear();
+}
+
+void LiquidCrystal::clear()
+{
+  memset(m_text, ' ', sizeof(m_text));
+  m_col = 0;
+  m_row = 0;
+}
+
+void LiquidCrystal::setCursor(uint8_t col, uint8_t row)
+{
+  m_col = col;
+  m_row = (row < m_rows) ? row : m_rows - 1;
+}
+
+size_t LiquidCrystal::write(uint8_t c)
+{
+  // Like the controller, text past the end of a row is not shown.
+  if (m_col < m_cols)
+  {
+    m_text[m_row][m_col] = c;
+  }
+  m_col++;
+  return 1;
+}
@@ -0,0 +1,55 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file LiquidCrystal.h
+///
+/// \brief HD44780 character display for host builds. Text is kept in a
+/// 20x4 copy of the display memory, which the host can print.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef LiquidCrystal_h
+#define LiquidCrystal_h
+
+#include <inttypes.h>
+#include "Print.h"
+
+class LiquidCrystal : public Print
+{
+  public:
+    LiquidCrystal(uint8_t rs, uint8_t enable, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7);
+
+    void begin(uint8_t cols, uint8_t rows, uint8_t charsize = 0);
+    void clear();
+    void noAutoscroll() {}
+    void createChar(uint8_t location, uint8_t charmap[]) {}
+    void setCursor(uint8_t col, uint8_t row);
+
+    virtual size_t write(uint8_t c);
+    using Print::write;
+
+    // One row of the display, without a terminating zero.
+    const char * row(uint8_t row) const { return m_text[row]; }
+
+  private:
+    char m_text[4][20];
+    uint8_t m_cols;
+    uint8_t m_rows;
+    uint8_t m_col;
+    uint8_t m_row;
+};
+
+#endif // LiquidCrystal_h
@@ -0,0 +1,55 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file SPI.h
+///
+/// \brief SPI library for host builds. Transfers go through SPDR like the
+/// Arduino library, so nothing answers them.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _SPI_H_INCLUDED
+#define _SPI_H_INCLUDED
+
+#include <Arduino.h>
+
+#define SPI_CLOCK_DIV4 0x00
+#define SPI_CLOCK_DIV16 0x01
+#define SPI_CLOCK_DIV64 0x02
+#define SPI_CLOCK_DIV128 0x03
+#define SPI_CLOCK_DIV2 0x04
+#define SPI_CLOCK_DIV8 0x05
+#define SPI_CLOCK_DIV32 0x06
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+class SPIClass
+{
+  public:
+    static void begin() { SPCR |= _BV(MSTR) | _BV(SPE); }
+    static void end() { SPCR &= ~_BV(SPE); }
+    static uint8_t transfer(uint8_t data) { SPDR = data; while (!(SPSR & _BV(SPIF))) ; return SPDR; }
+    static void setBitOrder(uint8_t order) { if (order == LSBFIRST) SPCR |= _BV(DORD); else SPCR &= ~_BV(DORD); }
+    static void setDataMode(uint8_t mode) { SPCR = (SPCR & ~0x0C) | mode; }
+    static void setClockDivider(uint8_t divider) { SPCR = (SPCR & ~0x03) | (divider & 0x03); SPSR = (SPSR & ~1) | ((divider >> 2) & 1); }
+};
+
+extern SPIClass SPI;
+
+#endif // _SPI_H_INCLUDED
@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file WString.h
+///
+/// \brief A small String class for host builds. The firmware only passes
+/// strings through it.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef String_class_h
+#define String_class_h
+
+#include <stdlib.h>
+#include <string.h>
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(PSTR(string_literal)))
+
+class String
+{
+  public:
+    String(const char * cstr = "") : m_buffer(strdup(cstr ? cstr : "")) {}
+    String(const String & other) : m_buffer(strdup(other.m_buffer)) {}
+    ~String() { free(m_buffer); }
+
+    String & operator=(const String & other)
+    {
+      if (this != &other)
+      {
+        free(m_buffer);
+        m_buffer = strdup(other.m_buffer);
+      }
+      return *this;
+    }
+
+    unsigned int length() const { return strlen(m_buffer); }
+    char operator[](unsigned int index) const { return index < length() ? m_buffer[index] : 0; }
+    const char * c_str() const { return m_buffer; }
+
+  private:
+    char * m_buffer;
+};
+
+#endif // String_class_h
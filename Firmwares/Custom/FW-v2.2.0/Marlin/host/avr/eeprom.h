@@ -0,0 +1,61 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file avr/eeprom.h
+///
+/// \brief EEPROM access for host builds. The 4 KB EEPROM is kept in a file
+/// (see host/HostCore.cpp).
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_AVR_EEPROM_H
+#define HOST_AVR_EEPROM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define EEMEM
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint8_t eeprom_read_byte(const uint8_t * address);
+uint16_t eeprom_read_word(const uint16_t * address);
+uint32_t eeprom_read_dword(const uint32_t * address);
+float eeprom_read_float(const float * address);
+void eeprom_read_block(void * destination, const void * source, size_t length);
+
+void eeprom_write_byte(uint8_t * address, uint8_t value);
+void eeprom_write_word(uint16_t * address, uint16_t value);
+void eeprom_write_dword(uint32_t * address, uint32_t value);
+void eeprom_write_float(float * address, float value);
+void eeprom_write_block(const void * source, void * destination, size_t length);
+
+void eeprom_update_byte(uint8_t * address, uint8_t value);
+void eeprom_update_word(uint16_t * address, uint16_t value);
+void eeprom_update_dword(uint32_t * address, uint32_t value);
+void eeprom_update_float(float * address, float value);
+void eeprom_update_block(const void * source, void * destination, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define eeprom_is_ready() 1
+#define eeprom_busy_wait() do { } while (0)
+
+#endif // HOST_AVR_EEPROM_H
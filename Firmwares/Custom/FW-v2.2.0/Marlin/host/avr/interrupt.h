@@ -0,0 +1,41 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file avr/interrupt.h
+///
+/// \brief Interrupt vectors and global interrupt flag for host builds.
+///
+/// An ISR is an ordinary C function named after its vector, which
+/// host/HostCore.cpp calls when the interrupt is raised and enabled.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+#include <avr/io.h>
+
+#define ISR(vector, ...) extern "C" void vector(void); extern "C" void vector(void)
+#define SIGNAL(vector) ISR(vector)
+#define EMPTY_INTERRUPT(vector) ISR(vector) { }
+
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+
+#define cli() (SREG &= (uint8_t) ~_BV(SREG_I))
+#define sei() (SREG |= (uint8_t) _BV(SREG_I))
+
+#endif // HOST_AVR_INTERRUPT_H
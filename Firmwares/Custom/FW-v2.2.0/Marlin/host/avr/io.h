@@ -0,0 +1,990 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file avr/io.h
+///
+/// \brief ATmega2560 registers for host builds (HOST_BUILD).
+///
+/// Every register is a variable, and also a macro of its own name so the
+/// firmware's #ifdef tests on registers work as with avr-libc. The ones whose
+/// writes do more than store a value on the chip (flags cleared by writing a
+/// one, SPIF and UDRE that the host keeps set, ADSC starting a conversion,
+/// the I bit of SREG) are HostIoRegister objects, so the firmware's own
+/// register code drives the emulation in host/HostCore.cpp.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+#define _BV(bit) (1 << (bit))
+#define _SFR_BYTE(sfr) (sfr)
+#define _SFR_WORD(sfr) (sfr)
+#define bit_is_set(sfr, bit) ((sfr) & _BV(bit))
+#define bit_is_clear(sfr, bit) (!((sfr) & _BV(bit)))
+
+#define RAMSTART 0x200
+#define RAMEND   0x21FF
+#define E2END    0xFFF
+#define FLASHEND 0x3FFFF
+
+// Ports
+extern volatile uint8_t PINA, DDRA, PORTA;
+#define PINA PINA
+#define DDRA DDRA
+#define PORTA PORTA
+extern volatile uint8_t PINB, DDRB, PORTB;
+#define PINB PINB
+#define DDRB DDRB
+#define PORTB PORTB
+extern volatile uint8_t PINC, DDRC, PORTC;
+#define PINC PINC
+#define DDRC DDRC
+#define PORTC PORTC
+extern volatile uint8_t PIND, DDRD, PORTD;
+#define PIND PIND
+#define DDRD DDRD
+#define PORTD PORTD
+extern volatile uint8_t PINE, DDRE, PORTE;
+#define PINE PINE
+#define DDRE DDRE
+#define PORTE PORTE
+extern volatile uint8_t PINF, DDRF, PORTF;
+#define PINF PINF
+#define DDRF DDRF
+#define PORTF PORTF
+extern volatile uint8_t PING, DDRG, PORTG;
+#define PING PING
+#define DDRG DDRG
+#define PORTG PORTG
+extern volatile uint8_t PINH, DDRH, PORTH;
+#define PINH PINH
+#define DDRH DDRH
+#define PORTH PORTH
+extern volatile uint8_t PINJ, DDRJ, PORTJ;
+#define PINJ PINJ
+#define DDRJ DDRJ
+#define PORTJ PORTJ
+extern volatile uint8_t PINK, DDRK, PORTK;
+#define PINK PINK
+#define DDRK DDRK
+#define PORTK PORTK
+extern volatile uint8_t PINL, DDRL, PORTL;
+#define PINL PINL
+#define DDRL DDRL
+#define PORTL PORTL
+
+#define PA0 0
+#define PORTA0 0
+#define DDA0 0
+#define PINA0 0
+#define PA1 1
+#define PORTA1 1
+#define DDA1 1
+#define PINA1 1
+#define PA2 2
+#define PORTA2 2
+#define DDA2 2
+#define PINA2 2
+#define PA3 3
+#define PORTA3 3
+#define DDA3 3
+#define PINA3 3
+#define PA4 4
+#define PORTA4 4
+#define DDA4 4
+#define PINA4 4
+#define PA5 5
+#define PORTA5 5
+#define DDA5 5
+#define PINA5 5
+#define PA6 6
+#define PORTA6 6
+#define DDA6 6
+#define PINA6 6
+#define PA7 7
+#define PORTA7 7
+#define DDA7 7
+#define PINA7 7
+#define PB0 0
+#define PORTB0 0
+#define DDB0 0
+#define PINB0 0
+#define PB1 1
+#define PORTB1 1
+#define DDB1 1
+#define PINB1 1
+#define PB2 2
+#define PORTB2 2
+#define DDB2 2
+#define PINB2 2
+#define PB3 3
+#define PORTB3 3
+#define DDB3 3
+#define PINB3 3
+#define PB4 4
+#define PORTB4 4
+#define DDB4 4
+#define PINB4 4
+#define PB5 5
+#define PORTB5 5
+#define DDB5 5
+#define PINB5 5
+#define PB6 6
+#define PORTB6 6
+#define DDB6 6
+#define PINB6 6
+#define PB7 7
+#define PORTB7 7
+#define DDB7 7
+#define PINB7 7
+#define PC0 0
+#define PORTC0 0
+#define DDC0 0
+#define PINC0 0
+#define PC1 1
+#define PORTC1 1
+#define DDC1 1
+#define PINC1 1
+#define PC2 2
+#define PORTC2 2
+#define DDC2 2
+#define PINC2 2
+#define PC3 3
+#define PORTC3 3
+#define DDC3 3
+#define PINC3 3
+#define PC4 4
+#define PORTC4 4
+#define DDC4 4
+#define PINC4 4
+#define PC5 5
+#define PORTC5 5
+#define DDC5 5
+#define PINC5 5
+#define PC6 6
+#define PORTC6 6
+#define DDC6 6
+#define PINC6 6
+#define PC7 7
+#define PORTC7 7
+#define DDC7 7
+#define PINC7 7
+#define PD0 0
+#define PORTD0 0
+#define DDD0 0
+#define PIND0 0
+#define PD1 1
+#define PORTD1 1
+#define DDD1 1
+#define PIND1 1
+#define PD2 2
+#define PORTD2 2
+#define DDD2 2
+#define PIND2 2
+#define PD3 3
+#define PORTD3 3
+#define DDD3 3
+#define PIND3 3
+#define PD4 4
+#define PORTD4 4
+#define DDD4 4
+#define PIND4 4
+#define PD5 5
+#define PORTD5 5
+#define DDD5 5
+#define PIND5 5
+#define PD6 6
+#define PORTD6 6
+#define DDD6 6
+#define PIND6 6
+#define PD7 7
+#define PORTD7 7
+#define DDD7 7
+#define PIND7 7
+#define PE0 0
+#define PORTE0 0
+#define DDE0 0
+#define PINE0 0
+#define PE1 1
+#define PORTE1 1
+#define DDE1 1
+#define PINE1 1
+#define PE2 2
+#define PORTE2 2
+#define DDE2 2
+#define PINE2 2
+#define PE3 3
+#define PORTE3 3
+#define DDE3 3
+#define PINE3 3
+#define PE4 4
+#define PORTE4 4
+#define DDE4 4
+#define PINE4 4
+#define PE5 5
+#define PORTE5 5
+#define DDE5 5
+#define PINE5 5
+#define PE6 6
+#define PORTE6 6
+#define DDE6 6
+#define PINE6 6
+#define PE7 7
+#define PORTE7 7
+#define DDE7 7
+#define PINE7 7
+#define PF0 0
+#define PORTF0 0
+#define DDF0 0
+#define PINF0 0
+#define PF1 1
+#define PORTF1 1
+#define DDF1 1
+#define PINF1 1
+#define PF2 2
+#define PORTF2 2
+#define DDF2 2
+#define PINF2 2
+#define PF3 3
+#define PORTF3 3
+#define DDF3 3
+#define PINF3 3
+#define PF4 4
+#define PORTF4 4
+#define DDF4 4
+#define PINF4 4
+#define PF5 5
+#define PORTF5 5
+#define DDF5 5
+#define PINF5 5
+#define PF6 6
+#define PORTF6 6
+#define DDF6 6
+#define PINF6 6
+#define PF7 7
+#define PORTF7 7
+#define DDF7 7
+#define PINF7 7
+#define PG0 0
+#define PORTG0 0
+#define DDG0 0
+#define PING0 0
+#define PG1 1
+#define PORTG1 1
+#define DDG1 1
+#define PING1 1
+#define PG2 2
+#define PORTG2 2
+#define DDG2 2
+#define PING2 2
+#define PG3 3
+#define PORTG3 3
+#define DDG3 3
+#define PING3 3
+#define PG4 4
+#define PORTG4 4
+#define DDG4 4
+#define PING4 4
+#define PG5 5
+#define PORTG5 5
+#define DDG5 5
+#define PING5 5
+#define PG6 6
+#define PORTG6 6
+#define DDG6 6
+#define PING6 6
+#define PG7 7
+#define PORTG7 7
+#define DDG7 7
+#define PING7 7
+#define PH0 0
+#define PORTH0 0
+#define DDH0 0
+#define PINH0 0
+#define PH1 1
+#define PORTH1 1
+#define DDH1 1
+#define PINH1 1
+#define PH2 2
+#define PORTH2 2
+#define DDH2 2
+#define PINH2 2
+#define PH3 3
+#define PORTH3 3
+#define DDH3 3
+#define PINH3 3
+#define PH4 4
+#define PORTH4 4
+#define DDH4 4
+#define PINH4 4
+#define PH5 5
+#define PORTH5 5
+#define DDH5 5
+#define PINH5 5
+#define PH6 6
+#define PORTH6 6
+#define DDH6 6
+#define PINH6 6
+#define PH7 7
+#define PORTH7 7
+#define DDH7 7
+#define PINH7 7
+#define PJ0 0
+#define PORTJ0 0
+#define DDJ0 0
+#define PINJ0 0
+#define PJ1 1
+#define PORTJ1 1
+#define DDJ1 1
+#define PINJ1 1
+#define PJ2 2
+#define PORTJ2 2
+#define DDJ2 2
+#define PINJ2 2
+#define PJ3 3
+#define PORTJ3 3
+#define DDJ3 3
+#define PINJ3 3
+#define PJ4 4
+#define PORTJ4 4
+#define DDJ4 4
+#define PINJ4 4
+#define PJ5 5
+#define PORTJ5 5
+#define DDJ5 5
+#define PINJ5 5
+#define PJ6 6
+#define PORTJ6 6
+#define DDJ6 6
+#define PINJ6 6
+#define PJ7 7
+#define PORTJ7 7
+#define DDJ7 7
+#define PINJ7 7
+#define PK0 0
+#define PORTK0 0
+#define DDK0 0
+#define PINK0 0
+#define PK1 1
+#define PORTK1 1
+#define DDK1 1
+#define PINK1 1
+#define PK2 2
+#define PORTK2 2
+#define DDK2 2
+#define PINK2 2
+#define PK3 3
+#define PORTK3 3
+#define DDK3 3
+#define PINK3 3
+#define PK4 4
+#define PORTK4 4
+#define DDK4 4
+#define PINK4 4
+#define PK5 5
+#define PORTK5 5
+#define DDK5 5
+#define PINK5 5
+#define PK6 6
+#define PORTK6 6
+#define DDK6 6
+#define PINK6 6
+#define PK7 7
+#define PORTK7 7
+#define DDK7 7
+#define PINK7 7
+#define PL0 0
+#define PORTL0 0
+#define DDL0 0
+#define PINL0 0
+#define PL1 1
+#define PORTL1 1
+#define DDL1 1
+#define PINL1 1
+#define PL2 2
+#define PORTL2 2
+#define DDL2 2
+#define PINL2 2
+#define PL3 3
+#define PORTL3 3
+#define DDL3 3
+#define PINL3 3
+#define PL4 4
+#define PORTL4 4
+#define DDL4 4
+#define PINL4 4
+#define PL5 5
+#define PORTL5 5
+#define DDL5 5
+#define PINL5 5
+#define PL6 6
+#define PORTL6 6
+#define DDL6 6
+#define PINL6 6
+#define PL7 7
+#define PORTL7 7
+#define DDL7 7
+#define PINL7 7
+
+// Timers. Counters, compare and capture registers of timers 1, 3, 4 and 5
+// are 16 bit, with the byte halves the firmware writes one at a time.
+extern volatile uint8_t TCCR0A, TCCR0B, TIMSK0, TCNT0, OCR0A, OCR0B;
+#define TCCR0A TCCR0A
+#define TCCR0B TCCR0B
+#define TIMSK0 TIMSK0
+#define TCNT0 TCNT0
+#define OCR0A OCR0A
+#define OCR0B OCR0B
+extern volatile uint8_t TCCR2A, TCCR2B, TIMSK2, TCNT2, OCR2A, OCR2B, ASSR, GTCCR;
+#define TCCR2A TCCR2A
+#define TCCR2B TCCR2B
+#define TIMSK2 TIMSK2
+#define TCNT2 TCNT2
+#define OCR2A OCR2A
+#define OCR2B OCR2B
+#define ASSR ASSR
+#define GTCCR GTCCR
+extern volatile uint8_t TCCR1A, TCCR1B, TCCR1C, TIMSK1;
+#define TCCR1A TCCR1A
+#define TCCR1B TCCR1B
+#define TCCR1C TCCR1C
+#define TIMSK1 TIMSK1
+extern volatile uint16_t TCNT1, OCR1A, OCR1B, OCR1C, ICR1;
+#define TCNT1 TCNT1
+#define OCR1A OCR1A
+#define OCR1B OCR1B
+#define OCR1C OCR1C
+#define ICR1 ICR1
+#define TCNT1L (((volatile uint8_t *)&TCNT1)[0])
+#define TCNT1H (((volatile uint8_t *)&TCNT1)[1])
+#define OCR1AL (((volatile uint8_t *)&OCR1A)[0])
+#define OCR1AH (((volatile uint8_t *)&OCR1A)[1])
+#define OCR1BL (((volatile uint8_t *)&OCR1B)[0])
+#define OCR1BH (((volatile uint8_t *)&OCR1B)[1])
+#define OCR1CL (((volatile uint8_t *)&OCR1C)[0])
+#define OCR1CH (((volatile uint8_t *)&OCR1C)[1])
+#define ICR1L (((volatile uint8_t *)&ICR1)[0])
+#define ICR1H (((volatile uint8_t *)&ICR1)[1])
+extern volatile uint8_t TCCR3A, TCCR3B, TCCR3C, TIMSK3;
+#define TCCR3A TCCR3A
+#define TCCR3B TCCR3B
+#define TCCR3C TCCR3C
+#define TIMSK3 TIMSK3
+extern volatile uint16_t TCNT3, OCR3A, OCR3B, OCR3C, ICR3;
+#define TCNT3 TCNT3
+#define OCR3A OCR3A
+#define OCR3B OCR3B
+#define OCR3C OCR3C
+#define ICR3 ICR3
+#define TCNT3L (((volatile uint8_t *)&TCNT3)[0])
+#define TCNT3H (((volatile uint8_t *)&TCNT3)[1])
+#define OCR3AL (((volatile uint8_t *)&OCR3A)[0])
+#define OCR3AH (((volatile uint8_t *)&OCR3A)[1])
+#define OCR3BL (((volatile uint8_t *)&OCR3B)[0])
+#define OCR3BH (((volatile uint8_t *)&OCR3B)[1])
+#define OCR3CL (((volatile uint8_t *)&OCR3C)[0])
+#define OCR3CH (((volatile uint8_t *)&OCR3C)[1])
+#define ICR3L (((volatile uint8_t *)&ICR3)[0])
+#define ICR3H (((volatile uint8_t *)&ICR3)[1])
+extern volatile uint8_t TCCR4A, TCCR4B, TCCR4C, TIMSK4;
+#define TCCR4A TCCR4A
+#define TCCR4B TCCR4B
+#define TCCR4C TCCR4C
+#define TIMSK4 TIMSK4
+extern volatile uint16_t TCNT4, OCR4A, OCR4B, OCR4C, ICR4;
+#define TCNT4 TCNT4
+#define OCR4A OCR4A
+#define OCR4B OCR4B
+#define OCR4C OCR4C
+#define ICR4 ICR4
+#define TCNT4L (((volatile uint8_t *)&TCNT4)[0])
+#define TCNT4H (((volatile uint8_t *)&TCNT4)[1])
+#define OCR4AL (((volatile uint8_t *)&OCR4A)[0])
+#define OCR4AH (((volatile uint8_t *)&OCR4A)[1])
+#define OCR4BL (((volatile uint8_t *)&OCR4B)[0])
+#define OCR4BH (((volatile uint8_t *)&OCR4B)[1])
+#define OCR4CL (((volatile uint8_t *)&OCR4C)[0])
+#define OCR4CH (((volatile uint8_t *)&OCR4C)[1])
+#define ICR4L (((volatile uint8_t *)&ICR4)[0])
+#define ICR4H (((volatile uint8_t *)&ICR4)[1])
+extern volatile uint8_t TCCR5A, TCCR5B, TCCR5C, TIMSK5;
+#define TCCR5A TCCR5A
+#define TCCR5B TCCR5B
+#define TCCR5C TCCR5C
+#define TIMSK5 TIMSK5
+extern volatile uint16_t TCNT5, OCR5A, OCR5B, OCR5C, ICR5;
+#define TCNT5 TCNT5
+#define OCR5A OCR5A
+#define OCR5B OCR5B
+#define OCR5C OCR5C
+#define ICR5 ICR5
+#define TCNT5L (((volatile uint8_t *)&TCNT5)[0])
+#define TCNT5H (((volatile uint8_t *)&TCNT5)[1])
+#define OCR5AL (((volatile uint8_t *)&OCR5A)[0])
+#define OCR5AH (((volatile uint8_t *)&OCR5A)[1])
+#define OCR5BL (((volatile uint8_t *)&OCR5B)[0])
+#define OCR5BH (((volatile uint8_t *)&OCR5B)[1])
+#define OCR5CL (((volatile uint8_t *)&OCR5C)[0])
+#define OCR5CH (((volatile uint8_t *)&OCR5C)[1])
+#define ICR5L (((volatile uint8_t *)&ICR5)[0])
+#define ICR5H (((volatile uint8_t *)&ICR5)[1])
+
+#define TOIE0 0
+#define OCIE0A 1
+#define OCIE0B 2
+#define TOV0 0
+#define OCF0A 1
+#define OCF0B 2
+#define WGM00 0
+#define WGM01 1
+#define WGM02 3
+#define COM0B0 4
+#define COM0B1 5
+#define COM0A0 6
+#define COM0A1 7
+#define CS00 0
+#define CS01 1
+#define CS02 2
+#define FOC0B 6
+#define FOC0A 7
+#define TOIE1 0
+#define OCIE1A 1
+#define OCIE1B 2
+#define TOV1 0
+#define OCF1A 1
+#define OCF1B 2
+#define OCIE1C 3
+#define ICIE1 5
+#define OCF1C 3
+#define ICF1 5
+#define WGM10 0
+#define WGM11 1
+#define COM1C0 2
+#define COM1C1 3
+#define COM1B0 4
+#define COM1B1 5
+#define COM1A0 6
+#define COM1A1 7
+#define CS10 0
+#define CS11 1
+#define CS12 2
+#define WGM12 3
+#define WGM13 4
+#define ICES1 6
+#define ICNC1 7
+#define FOC1C 5
+#define FOC1B 6
+#define FOC1A 7
+#define TOIE2 0
+#define OCIE2A 1
+#define OCIE2B 2
+#define TOV2 0
+#define OCF2A 1
+#define OCF2B 2
+#define WGM20 0
+#define WGM21 1
+#define WGM22 3
+#define COM2B0 4
+#define COM2B1 5
+#define COM2A0 6
+#define COM2A1 7
+#define CS20 0
+#define CS21 1
+#define CS22 2
+#define FOC2B 6
+#define FOC2A 7
+#define TOIE3 0
+#define OCIE3A 1
+#define OCIE3B 2
+#define TOV3 0
+#define OCF3A 1
+#define OCF3B 2
+#define OCIE3C 3
+#define ICIE3 5
+#define OCF3C 3
+#define ICF3 5
+#define WGM30 0
+#define WGM31 1
+#define COM3C0 2
+#define COM3C1 3
+#define COM3B0 4
+#define COM3B1 5
+#define COM3A0 6
+#define COM3A1 7
+#define CS30 0
+#define CS31 1
+#define CS32 2
+#define WGM32 3
+#define WGM33 4
+#define ICES3 6
+#define ICNC3 7
+#define FOC3C 5
+#define FOC3B 6
+#define FOC3A 7
+#define TOIE4 0
+#define OCIE4A 1
+#define OCIE4B 2
+#define TOV4 0
+#define OCF4A 1
+#define OCF4B 2
+#define OCIE4C 3
+#define ICIE4 5
+#define OCF4C 3
+#define ICF4 5
+#define WGM40 0
+#define WGM41 1
+#define COM4C0 2
+#define COM4C1 3
+#define COM4B0 4
+#define COM4B1 5
+#define COM4A0 6
+#define COM4A1 7
+#define CS40 0
+#define CS41 1
+#define CS42 2
+#define WGM42 3
+#define WGM43 4
+#define ICES4 6
+#define ICNC4 7
+#define FOC4C 5
+#define FOC4B 6
+#define FOC4A 7
+#define TOIE5 0
+#define OCIE5A 1
+#define OCIE5B 2
+#define TOV5 0
+#define OCF5A 1
+#define OCF5B 2
+#define OCIE5C 3
+#define ICIE5 5
+#define OCF5C 3
+#define ICF5 5
+#define WGM50 0
+#define WGM51 1
+#define COM5C0 2
+#define COM5C1 3
+#define COM5B0 4
+#define COM5B1 5
+#define COM5A0 6
+#define COM5A1 7
+#define CS50 0
+#define CS51 1
+#define CS52 2
+#define WGM52 3
+#define WGM53 4
+#define ICES5 6
+#define ICNC5 7
+#define FOC5C 5
+#define FOC5B 6
+#define FOC5A 7
+#define AS2 5
+#define TSM 7
+#define PSRSYNC 0
+#define PSRASY 1
+
+// ADC. ADC holds the last conversion, ADCSRA is special (see below).
+extern volatile uint16_t ADC;
+#define ADC ADC
+#define ADCW ADC
+#define ADCL (((volatile uint8_t *)&ADC)[0])
+#define ADCH (((volatile uint8_t *)&ADC)[1])
+extern volatile uint8_t ADCSRB, ADMUX, DIDR0, DIDR1, DIDR2, ACSR;
+#define ADCSRB ADCSRB
+#define ADMUX ADMUX
+#define DIDR0 DIDR0
+#define DIDR1 DIDR1
+#define DIDR2 DIDR2
+#define ACSR ACSR
+#define ADPS0 0
+#define ADPS1 1
+#define ADPS2 2
+#define ADIE 3
+#define ADIF 4
+#define ADATE 5
+#define ADSC 6
+#define ADEN 7
+#define ADTS0 0
+#define ADTS1 1
+#define ADTS2 2
+#define MUX5 3
+#define ACME 6
+#define MUX0 0
+#define MUX1 1
+#define MUX2 2
+#define MUX3 3
+#define MUX4 4
+#define ADLAR 5
+#define REFS0 6
+#define REFS1 7
+
+// USARTs. Only USART0 is connected (see host/HostSerial.cpp); UCSR0A and
+// UDR0 are special.
+extern volatile uint8_t UCSR0B, UCSR0C, UBRR0H, UBRR0L;
+#define UCSR0B UCSR0B
+#define UCSR0C UCSR0C
+#define UBRR0H UBRR0H
+#define UBRR0L UBRR0L
+extern volatile uint8_t UCSR1A, UCSR1B, UCSR1C, UBRR1H, UBRR1L, UDR1;
+#define UCSR1A UCSR1A
+#define UCSR1B UCSR1B
+#define UCSR1C UCSR1C
+#define UBRR1H UBRR1H
+#define UBRR1L UBRR1L
+#define UDR1 UDR1
+extern volatile uint8_t UCSR2A, UCSR2B, UCSR2C, UBRR2H, UBRR2L, UDR2;
+#define UCSR2A UCSR2A
+#define UCSR2B UCSR2B
+#define UCSR2C UCSR2C
+#define UBRR2H UBRR2H
+#define UBRR2L UBRR2L
+#define UDR2 UDR2
+extern volatile uint8_t UCSR3A, UCSR3B, UCSR3C, UBRR3H, UBRR3L, UDR3;
+#define UCSR3A UCSR3A
+#define UCSR3B UCSR3B
+#define UCSR3C UCSR3C
+#define UBRR3H UBRR3H
+#define UBRR3L UBRR3L
+#define UDR3 UDR3
+#define MPCM0 0
+#define U2X0 1
+#define UPE0 2
+#define DOR0 3
+#define FE0 4
+#define UDRE0 5
+#define TXC0 6
+#define RXC0 7
+#define TXB80 0
+#define RXB80 1
+#define UCSZ02 2
+#define TXEN0 3
+#define RXEN0 4
+#define UDRIE0 5
+#define TXCIE0 6
+#define RXCIE0 7
+#define UCPOL0 0
+#define UCSZ00 1
+#define UCSZ01 2
+#define USBS0 3
+#define UPM00 4
+#define UPM01 5
+#define UMSEL00 6
+#define UMSEL01 7
+#define MPCM1 0
+#define U2X1 1
+#define UPE1 2
+#define DOR1 3
+#define FE1 4
+#define UDRE1 5
+#define TXC1 6
+#define RXC1 7
+#define TXB81 0
+#define RXB81 1
+#define UCSZ12 2
+#define TXEN1 3
+#define RXEN1 4
+#define UDRIE1 5
+#define TXCIE1 6
+#define RXCIE1 7
+#define UCPOL1 0
+#define UCSZ10 1
+#define UCSZ11 2
+#define USBS1 3
+#define UPM10 4
+#define UPM11 5
+#define UMSEL10 6
+#define UMSEL11 7
+#define MPCM2 0
+#define U2X2 1
+#define UPE2 2
+#define DOR2 3
+#define FE2 4
+#define UDRE2 5
+#define TXC2 6
+#define RXC2 7
+#define TXB82 0
+#define RXB82 1
+#define UCSZ22 2
+#define TXEN2 3
+#define RXEN2 4
+#define UDRIE2 5
+#define TXCIE2 6
+#define RXCIE2 7
+#define UCPOL2 0
+#define UCSZ20 1
+#define UCSZ21 2
+#define USBS2 3
+#define UPM20 4
+#define UPM21 5
+#define UMSEL20 6
+#define UMSEL21 7
+#define MPCM3 0
+#define U2X3 1
+#define UPE3 2
+#define DOR3 3
+#define FE3 4
+#define UDRE3 5
+#define TXC3 6
+#define RXC3 7
+#define TXB83 0
+#define RXB83 1
+#define UCSZ32 2
+#define TXEN3 3
+#define RXEN3 4
+#define UDRIE3 5
+#define TXCIE3 6
+#define RXCIE3 7
+#define UCPOL3 0
+#define UCSZ30 1
+#define UCSZ31 2
+#define USBS3 3
+#define UPM30 4
+#define UPM31 5
+#define UMSEL30 6
+#define UMSEL31 7
+
+// SPI. SPSR and SPDR are special.
+extern volatile uint8_t SPCR;
+#define SPCR SPCR
+#define SPR0 0
+#define SPR1 1
+#define CPHA 2
+#define CPOL 3
+#define MSTR 4
+#define DORD 5
+#define SPE 6
+#define SPIE 7
+#define SPI2X 0
+#define WCOL 6
+#define SPIF 7
+
+// TWI, external and pin change interrupts: present, never raised.
+extern volatile uint8_t TWBR, TWSR, TWAR, TWDR, TWCR, TWAMR;
+#define TWBR TWBR
+#define TWSR TWSR
+#define TWAR TWAR
+#define TWDR TWDR
+#define TWCR TWCR
+#define TWAMR TWAMR
+extern volatile uint8_t EICRA, EICRB, EIMSK, EIFR, PCICR, PCIFR, PCMSK0, PCMSK1, PCMSK2;
+#define EICRA EICRA
+#define EICRB EICRB
+#define EIMSK EIMSK
+#define EIFR EIFR
+#define PCICR PCICR
+#define PCIFR PCIFR
+#define PCMSK0 PCMSK0
+#define PCMSK1 PCMSK1
+#define PCMSK2 PCMSK2
+#define TWIE 0
+#define TWEN 2
+#define TWWC 3
+#define TWSTO 4
+#define TWSTA 5
+#define TWEA 6
+#define TWINT 7
+#define TWPS0 0
+#define TWPS1 1
+
+// System
+extern volatile uint8_t MCUSR, WDTCSR, SMCR, PRR0, PRR1, OSCCAL, CLKPR, EECR, EEDR;
+#define MCUSR MCUSR
+#define WDTCSR WDTCSR
+#define SMCR SMCR
+#define PRR0 PRR0
+#define PRR1 PRR1
+#define OSCCAL OSCCAL
+#define CLKPR CLKPR
+#define EECR EECR
+#define EEDR EEDR
+extern volatile uint16_t EEAR;
+#define EEAR EEAR
+#define PORF 0
+#define EXTRF 1
+#define BORF 2
+#define WDRF 3
+#define JTRF 4
+#define WDP0 0
+#define WDP1 1
+#define WDP2 2
+#define WDE 3
+#define WDCE 4
+#define WDP3 5
+#define WDIE 6
+#define WDIF 7
+#define SREG_C 0
+#define SREG_Z 1
+#define SREG_N 2
+#define SREG_V 3
+#define SREG_S 4
+#define SREG_H 5
+#define SREG_T 6
+#define SREG_I 7
+
+#ifdef __cplusplus
+// A register whose writes are handled by the host instead of being stored
+// as they are. Reads return the stored value, or go through read when the
+// register has a side effect on reading.
+struct HostIoRegister
+{
+  volatile uint8_t value;
+  void (*write)(HostIoRegister & reg, uint8_t value);
+  uint8_t (*read)(HostIoRegister & reg);
+
+  operator uint8_t() const { return read ? read(const_cast<HostIoRegister &>(*this)) : value; }
+  HostIoRegister & operator=(uint8_t v) { write(*this, v); return *this; }
+  HostIoRegister & operator=(const HostIoRegister & r) { write(*this, r.value); return *this; }
+  HostIoRegister & operator|=(uint8_t v) { write(*this, value | v); return *this; }
+  HostIoRegister & operator&=(uint8_t v) { write(*this, value & v); return *this; }
+  HostIoRegister & operator^=(uint8_t v) { write(*this, value ^ v); return *this; }
+};
+
+// SREG: setting the I bit runs the interrupts that became pending while it
+// was clear, as sei() or restoring SREG does on the chip.
+extern HostIoRegister SREG;
+#define SREG SREG
+
+// ADCSRA: ADSC starts a conversion, which completes 13 ADC clocks later;
+// ADIF is cleared by writing a one.
+extern HostIoRegister ADCSRA;
+#define ADCSRA ADCSRA
+
+// SPSR always has SPIF set and SPDR reads 0xFF after a transfer: nothing
+// answers on the SPI bus.
+extern HostIoRegister SPSR, SPDR;
+#define SPSR SPSR
+#define SPDR SPDR
+
+// UCSR0A always has UDRE0 set, and RXC0 while a received byte waits in
+// UDR0. Reading UDR0 takes the byte, writing it sends a byte to the other
+// end of the port.
+extern HostIoRegister UCSR0A, UDR0;
+#define UCSR0A UCSR0A
+#define UDR0 UDR0
+
+// Interrupt flags, cleared by writing a one.
+extern HostIoRegister TIFR0, TIFR1, TIFR2, TIFR3, TIFR4, TIFR5;
+#define TIFR0 TIFR0
+#define TIFR1 TIFR1
+#define TIFR2 TIFR2
+#define TIFR3 TIFR3
+#define TIFR4 TIFR4
+#define TIFR5 TIFR5
+#endif // __cplusplus
+
+#endif // HOST_AVR_IO_H
@@ -0,0 +1,56 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file avr/wdt.h
+///
+/// \brief Watchdog for host builds. A host build has no watchdog reset; a
+/// firmware that stops calling the clock is reported by host/HostCore.cpp.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_AVR_WDT_H
+#define HOST_AVR_WDT_H
+
+#include <avr/io.h>
+
+#define WDTO_15MS  0
+#define WDTO_30MS  1
+#define WDTO_60MS  2
+#define WDTO_120MS 3
+#define WDTO_250MS 4
+#define WDTO_500MS 5
+#define WDTO_1S    6
+#define WDTO_2S    7
+#define WDTO_4S    8
+#define WDTO_8S    9
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void host_wdt_enable(uint8_t timeout);
+void host_wdt_disable(void);
+void host_wdt_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define wdt_enable(timeout) host_wdt_enable(timeout)
+#define wdt_disable() host_wdt_disable()
+#define wdt_reset() host_wdt_reset()
+
+#endif // HOST_AVR_WDT_H
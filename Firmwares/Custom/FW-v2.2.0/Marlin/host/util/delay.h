@@ -0,0 +1,40 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file util/delay.h
+///
+/// \brief Busy waits for host builds. They move the virtual clock forward.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_UTIL_DELAY_H
+#define HOST_UTIL_DELAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define _delay_ms(ms) delay((unsigned long)(ms))
+#define _delay_us(us) delayMicroseconds((unsigned int)(us))
+
+#endif // HOST_UTIL_DELAY_H
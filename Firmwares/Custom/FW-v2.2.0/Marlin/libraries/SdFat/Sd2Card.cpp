@@ -158,6 +158,9 @@ static void spiSend(uint8_t data) {
 //------------------------------------------------------------------------------
 // send command and return error code.  Return zero for OK
 uint8_t Sd2Card::cardCommand(uint8_t cmd, uint32_t arg) {
+  // end a multiple block read left open by readBlockStreaming()
+  if (streamBlock_ != NO_STREAM && cmd != CMD12) readStop();
+
   // select card
   chipSelectLow();
 
@@ -291,6 +294,7 @@ bool Sd2Card::eraseSingleBlockEnable() {
  */
 bool Sd2Card::init(uint8_t sckRateID, uint8_t chipSelectPin) {
   errorCode_ = type_ = 0;
+  streamBlock_ = NO_STREAM;
   chipSelectPin_ = chipSelectPin;
   // 16-bit init start time allows over a minute
   uint16_t t0 = (uint16_t)millis();
@@ -416,6 +420,33 @@ bool Sd2Card::readBlock(uint32_t blockNumber, uint8_t* dst) {
   return false;
 }
 //------------------------------------------------------------------------------
+/**
+ * Read a 512 byte block, leaving a multiple block read (CMD18) open
+ * afterwards. If the next call asks for the following block it is taken
+ * from the same sequence without sending a new command. Any other command
+ * ends the sequence first, so this can be mixed freely with readBlock()
+ * and writeBlock().
+ *
+ * \param[in] blockNumber Logical block to be read.
+ * \param[out] dst Pointer to the location that will receive the data.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::readBlockStreaming(uint32_t blockNumber, uint8_t* dst) {
+  if (blockNumber != streamBlock_) {
+    if (!readStart(blockNumber)) return false;
+  }
+  streamBlock_ = NO_STREAM;
+  if (!readData(dst)) {
+    // fall back to a single block read, which retries on its own
+    readStop();
+    return readBlock(blockNumber, dst);
+  }
+  streamBlock_ = blockNumber + 1;
+  return true;
+}
+//------------------------------------------------------------------------------
 /** Read one data block in a multiple block read sequence
  *
  * \param[in] dst Pointer to the location for the data to be read.
@@ -563,6 +594,7 @@ bool Sd2Card::readStart(uint32_t blockNumber) {
  * the value zero, false, is returned for failure.
  */
 bool Sd2Card::readStop() {
+  streamBlock_ = NO_STREAM;
   chipSelectLow();
   if (cardCommand(CMD12, 0)) {
     error(SD_CARD_ERROR_CMD12);
@@ -113,6 +113,18 @@ uint8_t const SD_CARD_TYPE_SD1  = 1;
 uint8_t const SD_CARD_TYPE_SD2  = 2;
 /** High Capacity SD card */
 uint8_t const SD_CARD_TYPE_SDHC = 3;
+//------------------------------------------------------------------------------
+#ifdef HOST_BUILD
+// With HOST_BUILD the card is a FAT16/FAT32 disk image (Sd2CardHost.cpp),
+// given with the --sd option. Each operation takes as long on the virtual
+// clock as it would take a real card on the 8 MHz SPI bus.
+/** Time of a command and its response, in microseconds */
+uint16_t const SD_HOST_COMMAND_US = 50;
+/** Time to move a 512 byte block over SPI, in microseconds */
+uint16_t const SD_HOST_BLOCK_US = 600;
+/** Flash programming time of a written block, in microseconds */
+uint16_t const SD_HOST_WRITE_US = 1000;
+#endif  // HOST_BUILD
 /**
  * define SOFTWARE_SPI to use bit-bang SPI
  */
@@ -156,7 +168,12 @@ uint8_t const SPI_SCK_PIN = SOFT_SPI_SCK_PIN;
 class Sd2Card {
  public:
   /** Construct an instance of Sd2Card. */
-  Sd2Card() : errorCode_(SD_CARD_ERROR_INIT_NOT_CALLED), type_(0) {}
+  Sd2Card() : errorCode_(SD_CARD_ERROR_INIT_NOT_CALLED), type_(0),
+    streamBlock_(NO_STREAM) {
+#ifdef HOST_BUILD
+    imageFd_ = -1;
+#endif  // HOST_BUILD
+  }
   uint32_t cardSize();
   bool erase(uint32_t firstBlock, uint32_t lastBlock);
   bool eraseSingleBlockEnable();
@@ -180,6 +197,7 @@ class Sd2Card {
   bool init(uint8_t sckRateID = SPI_FULL_SPEED,
     uint8_t chipSelectPin = SD_CHIP_SELECT_PIN);
   bool readBlock(uint32_t block, uint8_t* dst);
+  bool readBlockStreaming(uint32_t block, uint8_t* dst);
   /**
    * Read a card's CID register. The CID contains card identification
    * information such as Manufacturer ID, Product name, Product serial
@@ -215,6 +233,19 @@ class Sd2Card {
   bool writeData(const uint8_t* src);
   bool writeStart(uint32_t blockNumber, uint32_t eraseCount);
   bool writeStop();
+#ifdef HOST_BUILD
+  /** Card activity counted by the disk image backend. */
+  struct HostStats {
+    uint32_t commands;       // commands sent, CMD12 included
+    uint32_t blocksRead;
+    uint32_t blocksWritten;
+    uint32_t busyMicros;     // time the card took
+  };
+  /** \return the activity since init() or clearHostStats(). */
+  const HostStats& hostStats() const {return hostStats_;}
+  /** Restart the activity counters. */
+  void clearHostStats() {memset(&hostStats_, 0, sizeof(hostStats_));}
+#endif  // HOST_BUILD
  private:
   //----------------------------------------------------------------------------
   uint8_t chipSelectPin_;
@@ -222,6 +253,20 @@ class Sd2Card {
   uint8_t spiRate_;
   uint8_t status_;
   uint8_t type_;
+  // next block of the open multiple block read, see readBlockStreaming()
+  uint32_t streamBlock_;
+  static uint32_t const NO_STREAM = 0XFFFFFFFF;
+#ifdef HOST_BUILD
+  int imageFd_;
+  uint32_t imageBlocks_;
+  // next block of the open multiple block read or write
+  uint32_t hostBlock_;
+  HostStats hostStats_;
+  void hostCommand();
+  void hostWait(uint32_t micros);
+  bool hostRead(uint32_t blockNumber, uint8_t* dst);
+  bool hostWrite(uint32_t blockNumber, const uint8_t* src);
+#endif  // HOST_BUILD
   // private functions
   uint8_t cardAcmd(uint8_t cmd, uint32_t arg) {
     cardCommand(CMD55, 0);
@@ -0,0 +1,318 @@
+/* Arduino Sd2Card Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino Sd2Card Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino Sd2Card Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+// Disk image backend of Sd2Card for HOST_BUILD. It replaces the SPI
+// driver of Sd2Card.cpp, so SdVolume, SdBaseFile and the firmware above
+// them run unchanged on a Linux machine against a FAT16/FAT32 image, and
+// take as long on the virtual clock per command and block as a real card.
+
+#include "Marlin.h"
+
+#if defined(SDSUPPORT) && defined(HOST_BUILD)
+#include "Sd2Card.h"
+#include "Host.h"
+
+// After SdBaseFile.h, whose O_* open flags share the names of the macros
+// in fcntl.h.
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+//------------------------------------------------------------------------------
+/**
+ * Determine the size of the disk image.
+ *
+ * \return The number of 512 byte data blocks in the image
+ *         or zero if no image is open.
+ */
+uint32_t Sd2Card::cardSize() {
+  return imageFd_ < 0 ? 0 : imageBlocks_;
+}
+//------------------------------------------------------------------------------
+/** Erase a range of blocks, which reads back as zeros afterwards.
+ *
+ * \param[in] firstBlock The address of the first block in the range.
+ * \param[in] lastBlock The address of the last block in the range.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::erase(uint32_t firstBlock, uint32_t lastBlock) {
+  static const uint8_t zero[512] = {0};
+  if (streamBlock_ != NO_STREAM) readStop();
+  hostCommand();
+  for (uint32_t b = firstBlock; b <= lastBlock; b++) {
+    if (!hostWrite(b, zero)) {
+      error(SD_CARD_ERROR_ERASE);
+      return false;
+    }
+  }
+  return true;
+}
+//------------------------------------------------------------------------------
+/** The disk image can always erase single blocks. */
+bool Sd2Card::eraseSingleBlockEnable() {
+  return true;
+}
+//------------------------------------------------------------------------------
+/**
+ * Open the disk image given with the --sd option.
+ *
+ * \param[in] sckRateID Not used.
+ * \param[in] chipSelectPin Not used.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned if there is no image or it can't be
+ * opened, as if there was no card.
+ */
+bool Sd2Card::init(uint8_t sckRateID, uint8_t chipSelectPin) {
+  struct stat info;
+
+  errorCode_ = type_ = 0;
+  streamBlock_ = NO_STREAM;
+  chipSelectPin_ = chipSelectPin;
+  spiRate_ = sckRateID;
+  clearHostStats();
+
+  if (imageFd_ >= 0) close(imageFd_);
+  imageFd_ = host_sd_image ? open(host_sd_image, O_RDWR) : -1;
+  if (imageFd_ < 0 || fstat(imageFd_, &info) != 0) {
+    if (host_sd_image) perror(host_sd_image);
+    error(SD_CARD_ERROR_CMD0);
+    return false;
+  }
+  imageBlocks_ = info.st_size / 512;
+  type(SD_CARD_TYPE_SDHC);
+  return true;
+}
+//------------------------------------------------------------------------------
+/**
+ * Read a 512 byte block from the disk image.
+ *
+ * \param[in] blockNumber Logical block to be read.
+ * \param[out] dst Pointer to the location that will receive the data.
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::readBlock(uint32_t blockNumber, uint8_t* dst) {
+  if (streamBlock_ != NO_STREAM) readStop();
+  hostCommand();
+  if (!hostRead(blockNumber, dst)) {
+    error(SD_CARD_ERROR_CMD17);
+    return false;
+  }
+  return true;
+}
+//------------------------------------------------------------------------------
+/**
+ * Read a 512 byte block, leaving a multiple block read open afterwards,
+ * as Sd2Card.cpp does with CMD18.
+ *
+ * \param[in] blockNumber Logical block to be read.
+ * \param[out] dst Pointer to the location that will receive the data.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::readBlockStreaming(uint32_t blockNumber, uint8_t* dst) {
+  if (blockNumber != streamBlock_) {
+    if (!readStart(blockNumber)) return false;
+  }
+  streamBlock_ = NO_STREAM;
+  if (!readData(dst)) {
+    readStop();
+    return readBlock(blockNumber, dst);
+  }
+  streamBlock_ = blockNumber + 1;
+  return true;
+}
+//------------------------------------------------------------------------------
+/** Read one data block in a multiple block read sequence
+ *
+ * \param[in] dst Pointer to the location for the data to be read.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::readData(uint8_t *dst) {
+  if (!hostRead(hostBlock_, dst)) {
+    error(SD_CARD_ERROR_READ);
+    return false;
+  }
+  hostBlock_++;
+  return true;
+}
+//------------------------------------------------------------------------------
+/** Fill in the CID (all zeros) or a version 2 CSD matching the image */
+bool Sd2Card::readRegister(uint8_t cmd, void* buf) {
+  memset(buf, 0, 16);
+  hostCommand();
+  if (cmd == CMD9) {
+    csd2_t* csd = reinterpret_cast<csd2_t*>(buf);
+    uint32_t c_size = imageBlocks_ >= 1024 ? (imageBlocks_ >> 10) - 1 : 0;
+    csd->csd_ver = 1;
+    csd->read_bl_len = 9;
+    csd->c_size_high = c_size >> 16;
+    csd->c_size_mid = c_size >> 8;
+    csd->c_size_low = c_size;
+    csd->erase_blk_en = 1;
+  }
+  return true;
+}
+//------------------------------------------------------------------------------
+/** Start a read multiple blocks sequence.
+ *
+ * \param[in] blockNumber Address of first block in sequence.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::readStart(uint32_t blockNumber) {
+  if (streamBlock_ != NO_STREAM) readStop();
+  hostCommand();
+  if (blockNumber >= imageBlocks_) {
+    error(SD_CARD_ERROR_CMD18);
+    return false;
+  }
+  hostBlock_ = blockNumber;
+  return true;
+}
+//------------------------------------------------------------------------------
+/** End a read multiple blocks sequence.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::readStop() {
+  streamBlock_ = NO_STREAM;
+  hostCommand();
+  return true;
+}
+//------------------------------------------------------------------------------
+/**
+ * Check the SPI clock rate selector, which has no effect on the image.
+ *
+ * \param[in] sckRateID A value in the range [0, 6].
+ *
+ * \return The value one, true, is returned for success and the value zero,
+ * false, is returned for an invalid value of \a sckRateID.
+ */
+bool Sd2Card::setSckRate(uint8_t sckRateID) {
+  if (sckRateID > 6) {
+    error(SD_CARD_ERROR_SCK_RATE);
+    return false;
+  }
+  spiRate_ = sckRateID;
+  return true;
+}
+//------------------------------------------------------------------------------
+/**
+ * Writes a 512 byte block to the disk image.
+ *
+ * \param[in] blockNumber Logical block to be written.
+ * \param[in] src Pointer to the location of the data to be written.
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::writeBlock(uint32_t blockNumber, const uint8_t* src) {
+  if (streamBlock_ != NO_STREAM) readStop();
+  hostCommand();
+  if (!hostWrite(blockNumber, src)) {
+    error(SD_CARD_ERROR_CMD24);
+    return false;
+  }
+  // CMD13 status check after programming
+  hostCommand();
+  return true;
+}
+//------------------------------------------------------------------------------
+/** Write one data block in a multiple block write sequence
+ * \param[in] src Pointer to the location of the data to be written.
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::writeData(const uint8_t* src) {
+  if (!hostWrite(hostBlock_, src)) {
+    error(SD_CARD_ERROR_WRITE_MULTIPLE);
+    return false;
+  }
+  hostBlock_++;
+  return true;
+}
+//------------------------------------------------------------------------------
+/** Start a write multiple blocks sequence.
+ *
+ * \param[in] blockNumber Address of first block in sequence.
+ * \param[in] eraseCount The number of blocks to be pre-erased.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::writeStart(uint32_t blockNumber, uint32_t eraseCount) {
+  if (streamBlock_ != NO_STREAM) readStop();
+  // ACMD23 and CMD25
+  hostCommand();
+  hostCommand();
+  if (blockNumber >= imageBlocks_) {
+    error(SD_CARD_ERROR_CMD25);
+    return false;
+  }
+  hostBlock_ = blockNumber;
+  return true;
+}
+//------------------------------------------------------------------------------
+/** End a write multiple blocks sequence.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool Sd2Card::writeStop() {
+  hostCommand();
+  return true;
+}
+//------------------------------------------------------------------------------
+void Sd2Card::hostCommand() {
+  hostStats_.commands++;
+  hostWait(SD_HOST_COMMAND_US);
+}
+//------------------------------------------------------------------------------
+// take as long as the card would
+void Sd2Card::hostWait(uint32_t micros) {
+  hostStats_.busyMicros += micros;
+  host_advance((uint64_t)micros * HOST_CYCLES_PER_US);
+}
+//------------------------------------------------------------------------------
+bool Sd2Card::hostRead(uint32_t blockNumber, uint8_t* dst) {
+  if (imageFd_ < 0 || blockNumber >= imageBlocks_) return false;
+  hostWait(SD_HOST_BLOCK_US);
+  if (pread(imageFd_, dst, 512, (off_t)blockNumber * 512) != 512) return false;
+  hostStats_.blocksRead++;
+  return true;
+}
+//------------------------------------------------------------------------------
+bool Sd2Card::hostWrite(uint32_t blockNumber, const uint8_t* src) {
+  if (imageFd_ < 0 || blockNumber >= imageBlocks_) return false;
+  hostWait(SD_HOST_BLOCK_US + SD_HOST_WRITE_US);
+  if (pwrite(imageFd_, src, 512, (off_t)blockNumber * 512) != 512) return false;
+  hostStats_.blocksWritten++;
+  return true;
+}
+#endif  // SDSUPPORT && HOST_BUILD
@@ -1098,6 +1098,123 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
   return -1;
 }
 //------------------------------------------------------------------------------
+// Find the device block holding the current position. Returns the bytes
+// left in that block (up to end of file), zero at end of file or -1 on
+// error. The cluster is returned for skipCached(); curCluster_ is not
+// changed. With a map the cluster is computed instead of read from the FAT.
+int16_t SdBaseFile::locateBlock(uint32_t* block, uint32_t* cluster,
+  const SdExtentMap* map) {
+  uint16_t offset;
+  uint32_t n;
+
+  // error if not open or write only
+  if (!isOpen() || !(flags_ & O_READ)) goto fail;
+
+  if (curPosition_ >= fileSize_) return 0;
+
+  offset = curPosition_ & 0X1FF;  // offset in block
+  *cluster = curCluster_;
+  if (type_ == FAT_FILE_TYPE_ROOT_FIXED) {
+    *block = vol_->rootDirStart() + (curPosition_ >> 9);
+  } else {
+    uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+    if (map && map->lookup(curPosition_ >> (vol_->clusterSizeShift_ + 9),
+                           cluster)) {
+      // cluster taken from the map
+    } else if (offset == 0 && blockOfCluster == 0) {
+      // start of new cluster, same as read()
+      if (curPosition_ == 0) {
+        *cluster = firstCluster_;
+      } else {
+        if (!vol_->fatGet(curCluster_, cluster)) goto fail;
+      }
+    }
+    *block = vol_->clusterStartBlock(*cluster) + blockOfCluster;
+  }
+
+  n = fileSize_ - curPosition_;
+  if (n > (512U - offset)) n = 512 - offset;
+  return n;
+
+ fail:
+  return -1;
+}
+//------------------------------------------------------------------------------
+/** Give access to the rest of the current block without copying it.
+ *
+ * The block holding the current position is loaded into the volume cache
+ * and \a data is pointed at the current position inside it. The file
+ * position is not changed; the caller consumes bytes with skipCached().
+ * The data is only valid until the volume cache is used again.
+ *
+ * \param[out] data Set to the first unread byte in the cache.
+ *
+ * \param[out] cluster Cluster holding the data, to be passed to
+ * skipCached().
+ *
+ * \param[in] map Optional cluster map from mapClusters(). Mapped clusters
+ * are found without reading the FAT.
+ *
+ * \return The number of bytes available at \a data, up to the end of the
+ * block or of the file. Zero is returned at end of file and -1 if an error
+ * occurs.
+ */
+int16_t SdBaseFile::readCached(const uint8_t** data, uint32_t* cluster,
+  const SdExtentMap* map) {
+  uint32_t block;  // raw device block number
+  int16_t n = locateBlock(&block, cluster, map);
+  if (n <= 0) return n;
+
+  if (!vol_->cacheRawBlock(block, SdVolume::CACHE_FOR_READ)) return -1;
+  *data = vol_->cache()->data + (curPosition_ & 0X1FF);
+  return n;
+}
+//------------------------------------------------------------------------------
+/** Same as readCached() but the block is read into a buffer owned by the
+ * caller instead of the shared volume cache.
+ *
+ * FAT and directory lookups then can't evict the data being read, and
+ * sequential blocks are fetched with one open multiple block read
+ * (Sd2Card::readBlockStreaming()) instead of a command per block.
+ *
+ * \param[in,out] buffer Block buffer for this file. Call invalidate() on it
+ * after opening another file or reinitializing the card.
+ *
+ * \param[out] data Set to the first unread byte in the buffer.
+ *
+ * \param[out] cluster Cluster holding the data, to be passed to
+ * skipCached().
+ *
+ * \param[in] map Optional cluster map from mapClusters(). Mapped clusters
+ * are found without reading the FAT.
+ *
+ * \return The number of bytes available at \a data, up to the end of the
+ * block or of the file. Zero is returned at end of file and -1 if an error
+ * occurs.
+ */
+int16_t SdBaseFile::readAhead(SdReadAheadBuffer* buffer, const uint8_t** data,
+  uint32_t* cluster, const SdExtentMap* map) {
+  uint32_t block;  // raw device block number
+  int16_t n = locateBlock(&block, cluster, map);
+  if (n <= 0) return n;
+
+  uint16_t offset = curPosition_ & 0X1FF;
+  if (block == vol_->cacheBlockNumber()) {
+    // the volume cache may hold newer, unwritten data for this block
+    *data = vol_->cache()->data + offset;
+    return n;
+  }
+  if (buffer->block != block) {
+    if (!vol_->sdCard()->readBlockStreaming(block, buffer->data)) {
+      buffer->invalidate();
+      return -1;
+    }
+    buffer->block = block;
+  }
+  *data = buffer->data + offset;
+  return n;
+}
+//------------------------------------------------------------------------------
 /** Read the next directory entry from a directory file.
  *
  * \param[out] dir The dir_t struct that will receive the data.
@@ -1492,6 +1609,77 @@ bool SdBaseFile::seekSet(uint32_t pos) {
   return false;
 }
 //------------------------------------------------------------------------------
+/** Sets a file's position using a cluster map.
+ *
+ * Same as seekSet(uint32_t) but when the position is covered by \a map
+ * its cluster is computed instead of following the chain in the FAT.
+ *
+ * \param[in] pos The new position in bytes from the beginning of the file.
+ * \param[in] map Cluster map from mapClusters() for this file.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool SdBaseFile::seekSet(uint32_t pos, const SdExtentMap* map) {
+  // seekSet() keeps the cluster of the byte before the position
+  if (!map || !isOpen() || pos > fileSize_ || pos == 0 ||
+      type_ == FAT_FILE_TYPE_ROOT_FIXED ||
+      !map->lookup((pos - 1) >> (vol_->clusterSizeShift_ + 9), &curCluster_)) {
+    return seekSet(pos);
+  }
+  curPosition_ = pos;
+  return true;
+}
+//------------------------------------------------------------------------------
+/** Map the cluster chain of the file.
+ *
+ * The chain is read from the FAT once and kept as runs of consecutive
+ * clusters. A contiguous file needs a single run. If the file has more
+ * fragments than SdExtentMap::MAX_EXTENTS only its first part is mapped
+ * and the rest is still followed through the FAT.
+ *
+ * \param[out] map The map to fill.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure. On failure the map is
+ * left empty.
+ */
+bool SdBaseFile::mapClusters(SdExtentMap* map) {
+  uint32_t clusters;
+  uint32_t c;
+  uint32_t index;
+
+  map->clear();
+  if (!isOpen() || type_ == FAT_FILE_TYPE_ROOT_FIXED || firstCluster_ == 0 ||
+      fileSize_ == 0) {
+    goto fail;
+  }
+  // number of clusters the file size needs, also a guard against loops
+  clusters = ((fileSize_ - 1) >> (vol_->clusterSizeShift_ + 9)) + 1;
+
+  c = firstCluster_;
+  map->extent[0].index = 0;
+  map->extent[0].cluster = c;
+  map->count = 1;
+  for (index = 1; index < clusters; index++) {
+    uint32_t next;
+    if (!vol_->fatGet(c, &next) || vol_->isEOC(next)) goto fail;
+    if (next != c + 1) {
+      if (map->count == SdExtentMap::MAX_EXTENTS) break;
+      map->extent[map->count].index = index;
+      map->extent[map->count].cluster = next;
+      map->count++;
+    }
+    c = next;
+  }
+  map->mapped = index;
+  return true;
+
+ fail:
+  map->clear();
+  return false;
+}
+//------------------------------------------------------------------------------
 void SdBaseFile::setpos(fpos_t* pos) {
   curPosition_ = pos->position;
   curCluster_ = pos->cluster;
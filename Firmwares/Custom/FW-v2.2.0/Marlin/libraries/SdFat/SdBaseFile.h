@@ -29,6 +29,11 @@
 #include "Marlin.h"
 #include "SdFatConfig.h"
 #include "SdVolume.h"
+#ifdef HOST_BUILD
+// The C library's stdio.h has an fpos_t of its own.
+#include <stdio.h>
+#define fpos_t SdFpos_t
+#endif  // HOST_BUILD
 //------------------------------------------------------------------------------
 /**
  * \struct fpos_t
@@ -42,6 +47,60 @@ struct fpos_t {
   uint32_t cluster;
   fpos_t() : position(0), cluster(0) {}
 };
+//------------------------------------------------------------------------------
+/**
+ * \struct SdReadAheadBuffer
+ * \brief Block buffer owned by one reader, see SdBaseFile::readAhead().
+ */
+struct SdReadAheadBuffer {
+  /** raw device block held in data, or NO_BLOCK */
+  uint32_t block;
+  /** block contents */
+  uint8_t data[512];
+  /** value of block when nothing is buffered */
+  static uint32_t const NO_BLOCK = 0XFFFFFFFF;
+  /** Forget the buffered block. */
+  void invalidate() {block = NO_BLOCK;}
+  SdReadAheadBuffer() : block(NO_BLOCK) {}
+};
+//------------------------------------------------------------------------------
+/**
+ * \struct SdExtentMap
+ * \brief Cluster chain of one file as runs of consecutive clusters, see
+ * SdBaseFile::mapClusters(). A contiguous file is a single run.
+ */
+struct SdExtentMap {
+  /** number of runs kept; longer chains are only mapped up to here */
+  static uint8_t const MAX_EXTENTS = 8;
+  /** run of consecutive clusters */
+  struct Extent {
+    /** index in the file of the first cluster of the run */
+    uint32_t index;
+    /** first cluster of the run */
+    uint32_t cluster;
+  } extent[MAX_EXTENTS];
+  /** runs in use */
+  uint8_t count;
+  /** clusters of the file covered by the runs */
+  uint32_t mapped;
+  /** Forget the mapped chain. */
+  void clear() {count = 0; mapped = 0;}
+  /** \return true if the whole file is one run of clusters. */
+  bool contiguous() const {return count == 1;}
+  /** Find the cluster holding cluster \a index of the file.
+   * \param[in] index Position in the file divided by the cluster size.
+   * \param[out] cluster The cluster number.
+   * \return true if the index is mapped.
+   */
+  bool lookup(uint32_t index, uint32_t* cluster) const {
+    if (index >= mapped) return false;
+    uint8_t i = count - 1;
+    while (extent[i].index > index) i--;
+    *cluster = extent[i].cluster + (index - extent[i].index);
+    return true;
+  }
+  SdExtentMap() : count(0), mapped(0) {}
+};
 
 // use the gnu style oflag in open()
 /** open() oflag for reading */
@@ -283,6 +342,10 @@ class SdBaseFile {
   bool printName();
   int16_t read();
   int16_t read(void* buf, uint16_t nbyte);
+  int16_t readAhead(SdReadAheadBuffer* buffer, const uint8_t** data,
+    uint32_t* cluster, const SdExtentMap* map = 0);
+  int16_t readCached(const uint8_t** data, uint32_t* cluster,
+    const SdExtentMap* map = 0);
   int8_t readDir(dir_t* dir, char* longFilename);
   static bool remove(SdBaseFile* dirFile, const char* path);
   bool remove();
@@ -306,6 +369,18 @@ class SdBaseFile {
    */
   bool seekEnd(int32_t offset = 0) {return seekSet(fileSize_ + offset);}
   bool seekSet(uint32_t pos);
+  bool seekSet(uint32_t pos, const SdExtentMap* map);
+  bool mapClusters(SdExtentMap* map);
+  /** Advance the file position past \a nbyte bytes returned by readCached()
+   * or readAhead().
+   * \param[in] nbyte Number of bytes used, at most the count returned.
+   * \param[in] cluster The cluster returned with the data.
+   */
+  void skipCached(uint16_t nbyte, uint32_t cluster) {
+    if (nbyte == 0) return;
+    curCluster_ = cluster;
+    curPosition_ += nbyte;
+  }
   bool sync();
   bool timestamp(SdBaseFile* file);
   bool timestamp(uint8_t flag, uint16_t year, uint8_t month, uint8_t day,
@@ -352,6 +427,8 @@ class SdBaseFile {
   bool addCluster();
   bool addDirCluster();
   dir_t* cacheDirEntry(uint8_t action);
+  int16_t locateBlock(uint32_t* block, uint32_t* cluster,
+    const SdExtentMap* map);
   int8_t lsPrintNext( uint8_t flags, uint8_t indent);
   static bool make83Name(const char* str, uint8_t* name, const char** ptr);
   bool mkdir(SdBaseFile* parent, const uint8_t dname[11]);
@@ -32,6 +32,13 @@ int SdFatUtil::FreeRam() {
   char top;
   return &top - reinterpret_cast<char*>(sbrk(0));
 }
+#elif defined(HOST_BUILD)
+/** Amount of free RAM
+ * \return Always zero. A host build has no fixed RAM size to measure.
+ */
+int SdFatUtil::FreeRam() {
+  return 0;
+}
 #else  // __arm__
 extern char *__brkval;
 extern char __bss_end;
@@ -0,0 +1,135 @@
+#!/usr/bin/python
+"""Layer index generator
+
+Writes the layer index the firmware keeps next to a G-code file on the SD
+card (SD_LAYER_INDEX), so M861 can resume from any layer of a file that
+has never been printed. The index holds, for every layer, the byte offset
+of the line starting it and the position, extruder and feedrate before
+that line. A layer starts at each extruding move whose Z differs from the
+current layer by 0.05 mm or more, the same rule the firmware uses.
+
+The index must be copied next to the G-code file with the same 8.3 name
+and the LYR extension (PART.GCO -> PART.LYR). Files with long names are
+stored under a short name such as LONGNA~1.GCO; use that one.
+
+Usage: python layer_index.py [options] <file.gcode>
+
+Options:
+  -h, --help        show this help
+  --output=...      index file to write (default: the G-code file with the
+                    extension replaced by .LYR)
+"""
+
+import getopt
+import os
+import re
+import struct
+import sys
+
+MAGIC = 0x594C
+VERSION = 1
+MIN_STEP = 0.05
+
+WORD = re.compile(r"([A-Z])\s*([-+]?[0-9]*\.?[0-9]+)")
+
+
+def main(argv):
+    try:
+        opts, args = getopt.getopt(argv, "h", ["help", "output="])
+    except getopt.GetoptError as err:
+        print(str(err))
+        usage()
+        sys.exit(2)
+
+    output = None
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt == "--output":
+            output = arg
+
+    if len(args) != 1:
+        usage()
+        sys.exit(2)
+
+    if output is None:
+        output = os.path.splitext(args[0])[0] + ".LYR"
+
+    with open(args[0], "rb") as f:
+        data = f.read()
+
+    layers = index_layers(data)
+
+    with open(output, "wb") as f:
+        f.write(struct.pack("<HBBI", MAGIC, VERSION, 1, len(data)))
+        for layer in layers:
+            f.write(struct.pack("<I5f", *layer))
+
+    print("%d layers written to %s" % (len(layers), output))
+
+
+def index_layers(data):
+    """Returns (offset, x, y, z, e, feedrate) for each layer of the file."""
+    position = {"X": 0.0, "Y": 0.0, "Z": 0.0, "E": 0.0}
+    feedrate = 1500.0
+    relative = False
+    relative_e = False
+    layer_z = -1.0
+    layers = []
+
+    offset = 0
+    for raw in data.split(b"\n"):
+        line_offset = offset
+        offset += len(raw) + 1
+
+        line = raw.decode("ascii", "replace").split(";", 1)[0].strip().upper()
+        words = dict(WORD.findall(line))
+        if not words:
+            continue
+
+        if "G" in words:
+            g = int(float(words["G"]))
+            if g in (0, 1, 2, 3):
+                start = dict(position)
+                for axis in position:
+                    if axis in words:
+                        value = float(words[axis])
+                        if relative or (axis == "E" and relative_e):
+                            value += position[axis]
+                        position[axis] = value
+                if "F" in words and float(words["F"]) > 0:
+                    feedrate = float(words["F"])
+                if g in (0, 1) and position["E"] > start["E"] \
+                        and abs(position["Z"] - layer_z) >= MIN_STEP:
+                    layer_z = position["Z"]
+                    layers.append((line_offset, start["X"], start["Y"],
+                                   position["Z"], start["E"], feedrate))
+            elif g == 28:
+                homed = [a for a in "XYZ" if a in words] or list("XYZ")
+                for axis in homed:
+                    position[axis] = 0.0
+            elif g == 90:
+                relative = False
+            elif g == 91:
+                relative = True
+            elif g == 92:
+                for axis in position:
+                    if axis in words:
+                        position[axis] = float(words[axis])
+        elif "M" in words:
+            m = int(float(words["M"]))
+            if m == 82:
+                relative_e = False
+            elif m == 83:
+                relative_e = True
+
+    return layers
+
+
+def usage():
+    print(__doc__)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,207 @@
+#!/usr/bin/python
+"""SD upload tool and benchmark
+
+Copies a file to the SD card of the printer with M28 and reports the
+transfer rate. By default the file is sent as G-code lines with line
+numbers and checksums, one line in flight, as print hosts do. With
+--binary it is sent with M28 B1 (SD_FAST_UPLOAD) in frames of up to 512
+bytes:
+
+  sequence (1 byte) | length (2 bytes) | data | CRC-16/XMODEM (2 bytes)
+
+all little endian, the CRC covering the sequence, length and data. The
+sequence counts frames from 0 and wraps at 256. The firmware answers each
+frame with "ok" once it is stored or with "rs" to have it sent again. A
+frame whose answer is lost is sent again, and the firmware answers "ok"
+without storing it twice. An empty frame ends the upload. Binary uploads
+are stored byte for byte, comments included.
+
+Usage: python sd_upload.py [options] <port> <file> [<name on the card>]
+
+Options:
+  -h, --help        show this help
+  --baud=...        baud rate (default: 250000)
+  --binary          send binary frames instead of G-code lines
+  --timeout=...     seconds to wait for an answer before giving up (default: 30)
+"""
+
+import binascii
+import getopt
+import os
+import struct
+import sys
+import time
+
+import serial
+
+FRAME_SIZE = 512
+# Resends of the same frame before giving up
+MAX_RESENDS = 10
+# Seconds to wait for the answer to a frame before sending it again
+FRAME_TIMEOUT = 2.0
+
+
+def checksum(line):
+    cs = 0
+    for c in line:
+        cs ^= ord(c)
+    return cs & 0xff
+
+
+def clean(line):
+    line = line.split(';', 1)[0]
+    return line.strip()
+
+
+def main(argv):
+    try:
+        opts, args = getopt.getopt(argv, "h", ["help", "baud=", "binary", "timeout="])
+    except getopt.GetoptError as err:
+        print(str(err))
+        usage()
+        sys.exit(2)
+
+    baud = 250000
+    binary = False
+    timeout = 30.0
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt == "--baud":
+            baud = int(arg)
+        elif opt == "--binary":
+            binary = True
+        elif opt == "--timeout":
+            timeout = float(arg)
+
+    if len(args) not in (2, 3):
+        usage()
+        sys.exit(2)
+
+    name = args[2] if len(args) == 3 else os.path.basename(args[1]).upper()
+
+    port = serial.Serial(args[0], baud, timeout=timeout)
+    time.sleep(0.1)
+    port.reset_input_buffer()
+
+    start = time.time()
+    if binary:
+        sent, resends = upload_binary(port, args[1], name, timeout)
+    else:
+        sent, resends = upload_lines(port, args[1], name, timeout)
+    elapsed = time.time() - start
+    port.close()
+
+    if sent is None:
+        sys.exit(1)
+    print("Sent:         %d bytes in %.2f s" % (sent, elapsed))
+    if elapsed > 0:
+        print("Rate:         %.1f KB/s" % (sent / 1024.0 / elapsed))
+    print("Resends:      %d" % resends)
+
+
+def upload_lines(port, path, name, timeout):
+    with open(path) as f:
+        commands = [c for c in (clean(l) for l in f) if c]
+
+    # Reset the line number so the first numbered line is N1.
+    send(port, "M110 N0")
+    wait_ok(port, timeout)
+
+    commands = ["M28 %s" % name] + commands + ["M29"]
+    sent = 0
+    resends = 0
+    number = 1
+    while number <= len(commands):
+        send(port, "N%d %s" % (number, commands[number - 1]))
+        answer = wait_ok(port, timeout)
+        if answer is None:
+            print("No answer to line %d, giving up" % number)
+            return None, resends
+        if answer > 0:
+            resends += 1
+            number = answer
+        else:
+            if 1 < number < len(commands):
+                sent += len(commands[number - 1]) + 2
+            number += 1
+    return sent, resends
+
+
+def upload_binary(port, path, name, timeout):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    send(port, "M110 N0")
+    wait_ok(port, timeout)
+    send(port, "N1 M28 B1 %s" % name)
+    if wait_ok(port, timeout) != 0:
+        print("M28 B1 refused")
+        return None, 0
+
+    port.timeout = FRAME_TIMEOUT
+    resends = 0
+    retries = 0
+    offset = 0
+    sequence = 0
+    while True:
+        chunk = data[offset:offset + FRAME_SIZE]
+        header = struct.pack("<BH", sequence, len(chunk))
+        crc = binascii.crc_hqx(header + chunk, 0)
+        port.write(header + chunk + struct.pack("<H", crc))
+
+        answer = wait_frame(port, FRAME_TIMEOUT)
+        if answer is None or answer == "rs":
+            resends += 1
+            retries += 1
+            if retries > MAX_RESENDS:
+                print("The frame at byte %d keeps failing, giving up" % offset)
+                return None, resends
+            continue
+        retries = 0
+        if answer != "ok":
+            print(answer)
+            return None, resends
+        if not chunk:
+            return len(data), resends
+        offset += len(chunk)
+        sequence = (sequence + 1) & 0xff
+
+
+def send(port, line):
+    port.write(("%s*%d\n" % (line, checksum(line))).encode("ascii"))
+
+
+def wait_ok(port, timeout):
+    """Returns 0 on "ok", the requested line number on a resend request and
+    None when nothing arrives in time. Other output is skipped."""
+    resend = 0
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        answer = port.readline().decode("ascii", "replace").strip()
+        if answer.startswith("Resend:") or answer.startswith("rs "):
+            resend = int(answer.split(":" if ":" in answer else " ", 1)[1])
+        elif answer.startswith("Error:"):
+            print(answer)
+        elif answer.startswith("ok"):
+            return resend
+    return None
+
+
+def wait_frame(port, timeout):
+    """Returns "ok", "rs", the error message or None on a timeout."""
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        answer = port.readline().decode("ascii", "replace").strip()
+        if answer in ("ok", "rs") or answer.startswith("Error:"):
+            return answer
+    return None
+
+
+def usage():
+    print(__doc__)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
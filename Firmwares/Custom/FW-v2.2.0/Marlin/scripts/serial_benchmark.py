@@ -0,0 +1,132 @@
+#!/usr/bin/python
+"""Serial streaming benchmark
+
+Streams a G-code file to the firmware the way a print host does (line numbers,
+checksums, one line in flight, wait for "ok") and reports the line rate, the
+time from the end of each line to its "ok" and how many resends were requested.
+
+Usage: python serial_benchmark.py [options] <port> <file.gcode>
+
+Options:
+  -h, --help        show this help
+  --baud=...        baud rate (default: 250000)
+  --lines=...       stop after this many lines (default: whole file)
+  --timeout=...     seconds to wait for an answer before giving up (default: 30)
+"""
+
+import getopt
+import sys
+import time
+
+import serial
+
+
+def checksum(line):
+    cs = 0
+    for c in line:
+        cs ^= ord(c)
+    return cs & 0xff
+
+
+def clean(line):
+    line = line.split(';', 1)[0]
+    return line.strip()
+
+
+def main(argv):
+    try:
+        opts, args = getopt.getopt(argv, "h", ["help", "baud=", "lines=", "timeout="])
+    except getopt.GetoptError as err:
+        print(str(err))
+        usage()
+        sys.exit(2)
+
+    baud = 250000
+    max_lines = 0
+    timeout = 30.0
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt == "--baud":
+            baud = int(arg)
+        elif opt == "--lines":
+            max_lines = int(arg)
+        elif opt == "--timeout":
+            timeout = float(arg)
+
+    if len(args) != 2:
+        usage()
+        sys.exit(2)
+
+    with open(args[1]) as f:
+        commands = [c for c in (clean(l) for l in f) if c]
+    if max_lines > 0:
+        commands = commands[:max_lines]
+
+    port = serial.Serial(args[0], baud, timeout=timeout)
+    time.sleep(0.1)
+    port.reset_input_buffer()
+
+    # Reset the line number so the first numbered line is N1.
+    send(port, "M110 N0")
+    wait_ok(port, timeout)
+
+    latencies = []
+    resends = 0
+    number = 1
+    start = time.time()
+    while number <= len(commands):
+        sent = send(port, "N%d %s" % (number, commands[number - 1]))
+        answer = wait_ok(port, timeout)
+        latencies.append(time.time() - sent)
+        if answer is None:
+            print("No answer to line %d, giving up" % number)
+            break
+        if answer > 0:
+            resends += 1
+            number = answer
+        else:
+            number += 1
+    elapsed = time.time() - start
+    port.close()
+
+    done = number - 1
+    print("Lines:        %d in %.2f s" % (done, elapsed))
+    if elapsed > 0:
+        print("Lines/s:      %.1f" % (done / elapsed))
+    if latencies:
+        latencies.sort()
+        print("ok latency:   avg %.2f ms, median %.2f ms, max %.2f ms" % (
+            1000.0 * sum(latencies) / len(latencies),
+            1000.0 * latencies[len(latencies) // 2],
+            1000.0 * latencies[-1]))
+    print("Resends:      %d" % resends)
+
+
+def send(port, line):
+    port.write(("%s*%d\n" % (line, checksum(line))).encode("ascii"))
+    return time.time()
+
+
+def wait_ok(port, timeout):
+    """Returns 0 on "ok", the requested line number on a resend request and
+    None when nothing arrives in time. Other output (echo:, temperatures)
+    is skipped."""
+    resend = 0
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        answer = port.readline().decode("ascii", "replace").strip()
+        if answer.startswith("Resend:") or answer.startswith("rs "):
+            resend = int(answer.split(":" if ":" in answer else " ", 1)[1])
+        elif answer.startswith("ok"):
+            return resend
+    return None
+
+
+def usage():
+    print(__doc__)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -103,6 +103,16 @@ volatile signed char count_direction[NUM_AXIS] = { 1, 1, 1, 1};
 
 #define CHECK_ENDSTOPS  if(check_endstops)
 
+#ifdef HOST_BUILD
+// The products of the AVR versions below, in plain C for host builds. The
+// AVR MultiU24X24toH16 leaves out the lowest partial products, so its result
+// can be one less than this one.
+#define MultiU16X8toH16(intRes, charIn1, intIn2) \
+  intRes = (unsigned short)(((unsigned long)(unsigned char)(charIn1) * (unsigned short)(intIn2) + 0x80) >> 8)
+
+#define MultiU24X24toH16(intRes, longIn1, longIn2) \
+  intRes = (unsigned short)((((unsigned long long)((longIn1) & 0xFFFFFF) * ((longIn2) & 0xFFFFFF)) + 0x800000) >> 24)
+#else
 // intRes = intIn1 * intIn2 >> 16
 // uses:
 // r26 to store 0
@@ -172,6 +182,7 @@ asm volatile ( \
 : \
 "r26" , "r27" \
 )
+#endif // HOST_BUILD
 
 // Some useful constants
 
@@ -324,8 +335,7 @@ FORCE_INLINE unsigned short calc_timer(unsigned short step_rate) {
     step_loops = 1;
   }
 
-  unsigned short table_address = (unsigned short)&speed_lookuptable[step_rate];
-  timer = (unsigned short)pgm_read_word_near(table_address);
+  timer = (unsigned short)pgm_read_word_near(&speed_lookuptable[step_rate]);
 
   // Check frequency generated (1kHz this should never happen)
   if(timer < 2000)
@@ -30,6 +30,8 @@
 #include "GuiAction.h"
 #include "Action.h"
 
+#include <avr/pgmspace.h>
+
 #include "Icon.h"
 #include "IconWidget.h"
 #include "IconStatus.h"
@@ -64,6 +66,7 @@
 #include "ScreenStop.h"
 #include "ScreenStats.h"
 #include "ScreenError.h"
+#include "ViewPool.h"
 
 #include "AutoLevelManager.h"
 #include "LightManager.h"
@@ -78,6 +81,47 @@
 
 namespace ui
 {
+	///////////////////////////////////
+	// Memory of the view on display //
+	///////////////////////////////////
+
+	// Every type built below has to be listed here, pool_screen() and
+	// pool_item() refuse to build a larger one. A view is one screen with at
+	// most max_view_items icons or options, the most a menu or a setting
+	// screen holds.
+	typedef ViewPool::Largest<
+		ScreenAbout, ScreenAction<void>, ScreenAnimation<float>, ScreenComplete,
+		ScreenCooldown, ScreenDialog<void>, ScreenDynamicAxis<float>,
+		ScreenDynamicFeedrate<uint16_t>, ScreenEmergency, ScreenError, ScreenFile,
+		ScreenInactivity, ScreenLanguage, ScreenList, ScreenMenu, ScreenPrint,
+		ScreenSelector<void, uint16_t>, ScreenSerial, ScreenSetting, ScreenSplash,
+		ScreenStats, ScreenStop, ScreenSwitch, ScreenTemperature, ScreenTransition
+		> largest_screen;
+
+	typedef ViewPool::Largest<
+		Icon, IconStatus<bool>, IconStatus<PrinterState_t>, IconWidget<float>,
+		OptionLaunch, OptionToggle<bool>, OptionToggle<uint8_t>
+		> largest_item;
+
+	static const uint8_t max_view_items = (ScreenSetting::m_max_items > max_items) ? ScreenSetting::m_max_items : max_items;
+
+	uint8_t ViewPool::s_pool[largest_screen::size + max_view_items * largest_item::size] __attribute__((aligned));
+	const uint16_t ViewPool::s_size = sizeof(ViewPool::s_pool);
+
+	template <typename Type>
+		static inline Type * pool_screen(Type * view)
+	{
+		static_assert(sizeof(Type) <= largest_screen::size, "A screen type is missing from largest_screen");
+		return view;
+	}
+
+	template <typename Type>
+		static inline Type * pool_item(Type * item)
+	{
+		static_assert(sizeof(Type) <= largest_item::size, "An icon or option type is missing from largest_item");
+		return item;
+	}
+
 	///////////////////////
 	// Instantiate Icons //
 	///////////////////////
@@ -93,90 +137,33 @@ namespace ui
 
 	static ScreenSplash * make_screen_splash()
 	{
-		ScreenSplash * local_view = new ScreenSplash(2000);
+		ScreenSplash * local_view = pool_screen(new ScreenSplash(2000));
 		local_view->add(screen_main);
 		local_view->add(screen_wizard_init);
 		local_view->add(screen_emergency);
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_wizard_init()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_wizard_init);
-		local_view->add(screen_wizard_language);
-		return local_view;
-	}
-
 	static ScreenLanguage * make_screen_wizard_language()
 	{
-		ScreenLanguage * local_view = new ScreenLanguage(NULL, Language::EN);
+		ScreenLanguage * local_view = pool_screen(new ScreenLanguage(NULL, Language::EN));
 		local_view->add(screen_wizard_switch);
 		return local_view;
 	}
 
-	static ScreenSwitch * make_screen_wizard_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, action_check_wizard);
-		local_view->add(screen_wizard_step3);
-		local_view->add(screen_wizard_step1);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_wizard_step1()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_WIZARD_TITLE(), MSG_SCREEN_WIZARD_TEXT1(), MSG_PUSH_TO_CONTINUE(), do_nothing);
-		local_view->add(screen_wizard_step2);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_wizard_step2()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_WIZARD_TITLE(), MSG_SCREEN_WIZARD_TEXT2(), MSG_PUSH_TO_CONTINUE(), do_nothing);
-		local_view->add(screen_wizard_offset_home);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_wizard_offset_home()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_OFFSET_HOME_TITLE(), MSG_SCREEN_OFFSET_HOME_TEXT(), MSG_PLEASE_WAIT(), action_offset_homing);
-		local_view->add(screen_wizard_offset_calculate);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_wizard_offset_calculate()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_OFFSET_PLANE_TITLE(), MSG_SCREEN_OFFSET_PLANE_TEXT(), MSG_PLEASE_WAIT(), action_offset);
-		local_view->add(screen_wizard_offset_info);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_wizard_offset_info()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_OFFSET_INFO_TITLE(), MSG_SCREEN_OFFSET_INFO_TEXT(), MSG_PUSH_TO_CONTINUE(), do_nothing);
-		local_view->add(screen_wizard_offset_set);
-		return local_view;
-	}
-
 	static ScreenDynamicAxis<float> * make_screen_wizard_offset_set()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_OFFSET_SET_TITLE(), Z_AXIS, 0.0, 5.0, 0.02, action_set_offset, true);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_OFFSET_SET_TITLE(), Z_AXIS, 0.0, 5.0, 0.02, action_set_offset, true));
 		local_view->add(screen_wizard_offset_rest);
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_wizard_offset_rest()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_offset_rest);
-		local_view->add(screen_wizard_offset_finish);
-		return local_view;
-	}
-
 	static ScreenMenu * make_screen_wizard_offset_finish()
 	{
-		Icon * icon_retry = new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_retry = pool_item(new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_OFFSET_FINISH_TITLE(), MSG_SCREEN_OFFSET_FINISH_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_OFFSET_FINISH_TITLE(), MSG_SCREEN_OFFSET_FINISH_TEXT()));
 		local_view->add(screen_wizard_offset_home);
 		local_view->icon(icon_retry);
 		local_view->add(screen_wizard_offset_save);
@@ -184,53 +171,25 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_wizard_offset_save()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_save_offset);
-		local_view->add(screen_wizard_step3);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_wizard_step3()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_WIZARD_TITLE(), MSG_SCREEN_WIZARD_TEXT3(), MSG_PUSH_TO_CONTINUE(), do_nothing);
-		local_view->add(screen_wizard_step4);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_wizard_step4()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_WIZARD_TITLE(), MSG_SCREEN_WIZARD_TEXT4(), MSG_PUSH_TO_FINISH(), do_nothing);
-		local_view->add(screen_wizard_finish);
-		return local_view;
-	}
-
-	static ScreenAction<void> * make_screen_wizard_finish()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_wizard_finish);
-		local_view->add(screen_main);
-		return local_view;
-	}
-
 	static ScreenEmergency * make_screen_emergency()
 	{
-		ScreenEmergency * local_view = new ScreenEmergency(MSG_SCREEN_EMERGENCY_TITLE(), MSG_SCREEN_EMERGENCY_TEXT(), MSG_SCREEN_EMERGENCY_BOX(), bits_emergency);
+		ScreenEmergency * local_view = pool_screen(new ScreenEmergency(MSG_SCREEN_EMERGENCY_TITLE(), MSG_SCREEN_EMERGENCY_TEXT(), MSG_SCREEN_EMERGENCY_BOX(), bits_emergency));
 		return local_view;
 	}
 
 	static ScreenMenu * make_screen_main()
 	{
-		IconStatus<bool> * icon_sd = new IconStatus<bool>(icon_size, bits_nosd_normal, bits_nosd_focused, bits_sd_normal, bits_sd_focused, MSG_ICON_SD_NOSD(), MSG_ICON_SD_SD(), &SDManager::single::instance());
-		Icon * icon_filament_unload = new Icon(icon_size, bits_filament_unload_normal, bits_filament_unload_focused, MSG_ICON_FILAMENT_UNLOAD());
-		Icon * icon_filament_load = new Icon(icon_size, bits_filament_load_normal, bits_filament_load_focused, MSG_ICON_FILAMENT_LOAD());
-		Icon * icon_leveling = new Icon(icon_size, bits_leveling_normal, bits_leveling_focused, MSG_ICON_LEVELING());
-		Icon * icon_homing = new Icon(icon_size, bits_homing_normal, bits_homing_focused, MSG_ICON_HOMING());
-		Icon * icon_settings = new Icon(icon_size, bits_settings_normal, bits_settings_focused, MSG_ICON_SETTINGS());
-		Icon * icon_moveaxis = new Icon(icon_size, bits_moveaxis_normal, bits_moveaxis_focused, MSG_ICON_MOVEAXIS());
-		IconStatus<bool> * icon_steppers = new IconStatus<bool>(icon_size, bits_steppers_normal, bits_steppers_focused, bits_steppers_off_normal, bits_steppers_off_focused, MSG_ICON_STEPPERS(), MSG_ICON_STEPPERS_OFF(), &SteppersManager::single::instance());
-		IconWidget<float> * widget_temperature = new IconWidget<float>(widget_size, bits_temperature_widget_normal, bits_temperature_widget_focused, MSG_ICON_TEMPERATURE(), &temp::TemperatureManager::single::instance());
-
-		ScreenMenu * local_view = new ScreenMenu();
+		IconStatus<bool> * icon_sd = pool_item(new IconStatus<bool>(icon_size, bits_nosd_normal, bits_nosd_focused, bits_sd_normal, bits_sd_focused, MSG_ICON_SD_NOSD(), MSG_ICON_SD_SD(), &SDManager::single::instance()));
+		Icon * icon_filament_unload = pool_item(new Icon(icon_size, bits_filament_unload_normal, bits_filament_unload_focused, MSG_ICON_FILAMENT_UNLOAD()));
+		Icon * icon_filament_load = pool_item(new Icon(icon_size, bits_filament_load_normal, bits_filament_load_focused, MSG_ICON_FILAMENT_LOAD()));
+		Icon * icon_leveling = pool_item(new Icon(icon_size, bits_leveling_normal, bits_leveling_focused, MSG_ICON_LEVELING()));
+		Icon * icon_homing = pool_item(new Icon(icon_size, bits_homing_normal, bits_homing_focused, MSG_ICON_HOMING()));
+		Icon * icon_settings = pool_item(new Icon(icon_size, bits_settings_normal, bits_settings_focused, MSG_ICON_SETTINGS()));
+		Icon * icon_moveaxis = pool_item(new Icon(icon_size, bits_moveaxis_normal, bits_moveaxis_focused, MSG_ICON_MOVEAXIS()));
+		IconStatus<bool> * icon_steppers = pool_item(new IconStatus<bool>(icon_size, bits_steppers_normal, bits_steppers_focused, bits_steppers_off_normal, bits_steppers_off_focused, MSG_ICON_STEPPERS(), MSG_ICON_STEPPERS_OFF(), &SteppersManager::single::instance()));
+		IconWidget<float> * widget_temperature = pool_item(new IconWidget<float>(widget_size, bits_temperature_widget_normal, bits_temperature_widget_focused, MSG_ICON_TEMPERATURE(), &temp::TemperatureManager::single::instance()));
+
+		ScreenMenu * local_view = pool_screen(new ScreenMenu());
 		local_view->add(screen_SD_list);
 		local_view->icon(icon_sd);
 		local_view->add(screen_load_init);
@@ -254,7 +213,7 @@ namespace ui
 
 	static ScreenList * make_screen_SD_list()
 	{
-		ScreenList * local_view = new ScreenList(MSG_SCREEN_SD_LIST_TITLE(), &SDManager::single::instance());
+		ScreenList * local_view = pool_screen(new ScreenList(MSG_SCREEN_SD_LIST_TITLE(), &SDManager::single::instance()));
 		local_view->add(screen_main);
 		local_view->add(screen_SD_confirm);
 		local_view->add(screen_SD_name_error);
@@ -263,10 +222,10 @@ namespace ui
 	
 	static ScreenFile * make_screen_SD_confirm()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenFile * local_view = new ScreenFile(MSG_SCREEN_SD_LIST_CONFIRM(), &SDManager::single::instance());
+		ScreenFile * local_view = pool_screen(new ScreenFile(MSG_SCREEN_SD_LIST_CONFIRM(), &SDManager::single::instance()));
 		local_view->add(screen_SD_list);
 		local_view->icon(icon_back);
 		local_view->add(screen_print_switch);
@@ -276,17 +235,17 @@ namespace ui
 	
 	static ScreenError * make_screen_SD_name_error()
 	{
-		ScreenError * local_view = new ScreenError(MSG_SCREEN_ERROR_TITLE(), MSG_SCREEN_NAME_ERROR_TEXT(), MSG_PUSH_TO_BACK(), bits_emergency);
+		ScreenError * local_view = pool_screen(new ScreenError(MSG_SCREEN_ERROR_TITLE(), MSG_SCREEN_NAME_ERROR_TEXT(), MSG_PUSH_TO_BACK(), bits_emergency));
 		local_view->add(screen_main);
 		return local_view;
 	}
 
 	static ScreenMenu * make_screen_unload_init()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_UNLOAD_INIT_TITLE(), MSG_SCREEN_UNLOAD_INIT_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_UNLOAD_INIT_TITLE(), MSG_SCREEN_UNLOAD_INIT_TEXT()));
 		local_view->add(screen_main);
 		local_view->icon(icon_back);
 		local_view->add(screen_unload_select);
@@ -296,60 +255,24 @@ namespace ui
 
 	static ScreenSelector<void, uint16_t> * make_screen_unload_select()
 	{
-		ScreenSelector<void, uint16_t> * local_view = new ScreenSelector<void, uint16_t>(MSG_SCREEN_UNLOAD_SELECT_TITLE(), MSG_PUSH_TO_CONFIRM(), temp::min_temp_operation, temp::max_temp_operation, 1, temp::default_temp_change_filament, action_set_temperature);
+		ScreenSelector<void, uint16_t> * local_view = pool_screen(new ScreenSelector<void, uint16_t>(MSG_SCREEN_UNLOAD_SELECT_TITLE(), MSG_PUSH_TO_CONFIRM(), temp::min_temp_operation, temp::max_temp_operation, 1, temp::default_temp_change_filament, action_set_temperature));
 		local_view->add(screen_unload_heating);
 		return local_view;
 	}
 
 	static ScreenAnimation<float> * make_screen_unload_heating()
 	{
-		ScreenAnimation<float> * local_view = new ScreenAnimation<float>(MSG_SCREEN_UNLOAD_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenAnimation<float> * local_view = pool_screen(new ScreenAnimation<float>(MSG_SCREEN_UNLOAD_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_unload_switch);
 		return local_view;
 	}
 
-	static ScreenSwitch * make_screen_unload_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, PrintManager::knownPosition);
-		local_view->add(screen_move_to_unload);
-		local_view->add(screen_unload_home);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_unload_home()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_UNLOAD_HOME_TITLE(), MSG_SCREEN_UNLOAD_HOME_TEXT(), MSG_PLEASE_WAIT(), action_homing);
-		local_view->add(screen_move_to_unload);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_move_to_unload()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_MOVE_TO_UNLOAD_TITLE(), MSG_SCREEN_MOVE_TO_UNLOAD_TEXT(), MSG_PLEASE_WAIT(), action_move_to_filament_change);
-		local_view->add(screen_unload_info);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_unload_info()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_UNLOAD_INFO_TITLE(), MSG_SCREEN_UNLOAD_INFO_TEXT(), MSG_PUSH_TO_START(), do_nothing);
-		local_view->add(screen_unloading);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_unloading()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_UNLOADING_TITLE(), MSG_SCREEN_UNLOADING_TEXT(), MSG_PLEASE_WAIT(), action_filament_unload);
-		local_view->add(screen_unload_confirm);
-		return local_view;
-	}
-
 	static ScreenMenu * make_screen_unload_confirm()
 	{
-		Icon * icon_retry = new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_retry = pool_item(new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_UNLOAD_CONFIRM_TITLE(), MSG_SCREEN_UNLOAD_CONFIRM_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_UNLOAD_CONFIRM_TITLE(), MSG_SCREEN_UNLOAD_CONFIRM_TEXT()));
 		local_view->add(screen_unload_info);
 		local_view->icon(icon_retry);
 		local_view->add(screen_unload_rest);
@@ -357,19 +280,12 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_unload_rest()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_move_to_rest);
-		local_view->add(screen_main);
-		return local_view;
-	}
-
 	static ScreenMenu * make_screen_load_init()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_LOAD_INIT_TITLE(), MSG_SCREEN_LOAD_INIT_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_LOAD_INIT_TITLE(), MSG_SCREEN_LOAD_INIT_TEXT()));
 		local_view->add(screen_main);
 		local_view->icon(icon_back);
 		local_view->add(screen_load_select);
@@ -379,60 +295,24 @@ namespace ui
 
 	static ScreenSelector<void, uint16_t> * make_screen_load_select()
 	{
-		ScreenSelector<void, uint16_t> * local_view  = new ScreenSelector<void, uint16_t>(MSG_SCREEN_LOAD_SELECT_TITLE(), MSG_PUSH_TO_CONFIRM(), temp::min_temp_operation, temp::max_temp_operation, 1, temp::default_temp_change_filament, action_set_temperature);
+		ScreenSelector<void, uint16_t> * local_view  = pool_screen(new ScreenSelector<void, uint16_t>(MSG_SCREEN_LOAD_SELECT_TITLE(), MSG_PUSH_TO_CONFIRM(), temp::min_temp_operation, temp::max_temp_operation, 1, temp::default_temp_change_filament, action_set_temperature));
 		local_view->add(screen_load_heating);
 		return local_view;
 	}
 
 	static ScreenAnimation<float> * make_screen_load_heating()
 	{
-		ScreenAnimation<float> * local_view = new ScreenAnimation<float>(MSG_SCREEN_LOAD_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenAnimation<float> * local_view = pool_screen(new ScreenAnimation<float>(MSG_SCREEN_LOAD_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_load_switch);
 		return local_view;
 	}
 
-	static ScreenSwitch * make_screen_load_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, PrintManager::knownPosition);
-		local_view->add(screen_move_to_load);
-		local_view->add(screen_load_home);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_load_home()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_LOAD_HOME_TITLE(), MSG_SCREEN_LOAD_HOME_TEXT(), MSG_PLEASE_WAIT(), action_homing);
-		local_view->add(screen_move_to_load);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_move_to_load()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_MOVE_TO_LOAD_TITLE(), MSG_SCREEN_MOVE_TO_LOAD_TEXT(), MSG_PLEASE_WAIT(), action_move_to_filament_change);
-		local_view->add(screen_load_info);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_load_info()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_LOAD_INFO_TITLE(), MSG_SCREEN_LOAD_INFO_TEXT(), MSG_PUSH_TO_START(), do_nothing);
-		local_view->add(screen_loading);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_loading()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_LOADING_TITLE(), MSG_SCREEN_LOADING_TEXT(), MSG_PLEASE_WAIT(), action_filament_load);
-		local_view->add(screen_load_confirm);
-		return local_view;
-	}
-
 	static ScreenMenu * make_screen_load_confirm()
 	{
-		Icon * icon_retry = new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_retry = pool_item(new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_LOAD_CONFIRM_TITLE(), MSG_SCREEN_LOAD_CONFIRM_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_LOAD_CONFIRM_TITLE(), MSG_SCREEN_LOAD_CONFIRM_TEXT()));
 		local_view->add(screen_load_info);
 		local_view->icon(icon_retry);
 		local_view->add(screen_load_rest);
@@ -440,19 +320,12 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_load_rest()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_move_to_rest);
-		local_view->add(screen_main);
-		return local_view;
-	}
-
 	static ScreenMenu * make_screen_level_init()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_LEVEL_INIT_TITLE(), MSG_SCREEN_LEVEL_INIT_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_LEVEL_INIT_TITLE(), MSG_SCREEN_LEVEL_INIT_TEXT()));
 		local_view->add(screen_main);
 		local_view->icon(icon_back);
 		local_view->add(screen_level_switch_preheat);
@@ -460,84 +333,19 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenSwitch * make_screen_level_switch_preheat()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, action_check_preheat_temp);
-		local_view->add(screen_level_switch);
-		local_view->add(screen_level_preheat);
-		return local_view;
-	}
-
-	static ScreenAction<void> * make_screen_level_preheat()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_preheat);
-		local_view->add(screen_level_preheating);
-		return local_view;
-	}
-
 	static ScreenAnimation<float> * make_screen_level_preheating()
 	{
-		ScreenAnimation<float> * local_view = new ScreenAnimation<float>(MSG_SCREEN_LEVEL_PREHEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenAnimation<float> * local_view = pool_screen(new ScreenAnimation<float>(MSG_SCREEN_LEVEL_PREHEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_level_switch);
 		return local_view;
 	}
 
-	static ScreenSwitch * make_screen_level_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, PrintManager::knownPosition);
-		local_view->add(screen_level1);
-		local_view->add(screen_level_homing);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_level_homing()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_LEVEL_HOMING_TITLE(), MSG_SCREEN_LEVEL_HOMING_TEXT(), MSG_PLEASE_WAIT(), action_homing);
-		local_view->add(screen_level1);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_level1()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_LEVEL1_TITLE(), MSG_SCREEN_LEVEL1_TEXT(), MSG_PUSH_TO_CONTINUE(), action_level_plate);
-		local_view->add(screen_level2);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_level2()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_LEVEL2_TITLE(), MSG_SCREEN_LEVEL2_TEXT(), MSG_PUSH_TO_CONTINUE(), action_level_plate);
-		local_view->add(screen_level3);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_level3()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_LEVEL3_TITLE(), MSG_SCREEN_LEVEL3_TEXT(), MSG_PUSH_TO_CONTINUE(), action_level_plate);
-		local_view->add(screen_level4);
-		return local_view;
-	}
-
-	static ScreenAction<void> * make_screen_level4()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_level_plate);
-		local_view->add(screen_level_z_homing);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_level_z_homing()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_LEVEL_HOMING_TITLE(), MSG_SCREEN_LEVEL_HOMING_TEXT(), MSG_PLEASE_WAIT(), gui_action_z_homing);
-		local_view->add(screen_level_confirm);
-		return local_view;
-	}
-
 	static ScreenMenu * make_screen_level_confirm()
 	{
-		Icon * icon_retry = new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_retry = pool_item(new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_LEVEL_CONFIRM_TITLE(), MSG_SCREEN_LEVEL_CONFIRM_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_LEVEL_CONFIRM_TITLE(), MSG_SCREEN_LEVEL_CONFIRM_TEXT()));
 		local_view->add(screen_level_homing);
 		local_view->icon(icon_retry);
 		local_view->add(screen_main);
@@ -547,10 +355,10 @@ namespace ui
 
 	static ScreenMenu * make_screen_autohome_init()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_AUTOHOME_INIT_TITLE(), MSG_SCREEN_AUTOHOME_INIT_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_AUTOHOME_INIT_TITLE(), MSG_SCREEN_AUTOHOME_INIT_TEXT()));
 		local_view->add(screen_main);
 		local_view->icon(icon_back);
 		local_view->add(screen_autohome_switch);
@@ -558,62 +366,40 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenSwitch * make_screen_autohome_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, action_check_preheat_temp);
-		local_view->add(screen_autohome_homing);
-		local_view->add(screen_autohome_heating);
-		return local_view;
-	}
-
-	static ScreenAction<void> * make_screen_autohome_heating()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_preheat);
-		local_view->add(screen_autohome_animation);
-		return local_view;
-	}
-
 	static ScreenAnimation<float> * make_screen_autohome_animation()
 	{
-		ScreenAnimation<float> * local_view = new ScreenAnimation<float>(MSG_SCREEN_AUTOHOME_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenAnimation<float> * local_view = pool_screen(new ScreenAnimation<float>(MSG_SCREEN_AUTOHOME_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_autohome_homing);
 		return local_view;
 	}
 
 
-	static ScreenTransition * make_screen_autohome_homing()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_AUTOHOME_HOMING_TITLE(), MSG_SCREEN_AUTOHOME_HOMING_TEXT(), MSG_PLEASE_WAIT(), gui_action_homing);
-		local_view->add(screen_main);
-		return local_view;
-	}
-
 	static ScreenSetting * make_screen_settings()
 	{
-		OptionLaunch * option_back        = new OptionLaunch(option_size, MSG_BACK());
+		OptionLaunch * option_back        = pool_item(new OptionLaunch(option_size, MSG_BACK()));
 		option_back->add(screen_main);
-		OptionToggle<bool> * option_autolevel   = new OptionToggle<bool> (option_size, MSG_OPTION_AUTOLEVEL(), AutoLevelManager::setState, &AutoLevelManager::single::instance());
+		OptionToggle<bool> * option_autolevel   = pool_item(new OptionToggle<bool> (option_size, MSG_OPTION_AUTOLEVEL(), AutoLevelManager::setState, &AutoLevelManager::single::instance()));
 #ifdef LIGHT_ENABLED
-		OptionToggle<uint8_t>  * option_led         = new OptionToggle<uint8_t>(option_size, MSG_OPTION_LIGHTLED(), LightManager::setMode, &LightManager::single::instance());
+		OptionToggle<uint8_t>  * option_led         = pool_item(new OptionToggle<uint8_t>(option_size, MSG_OPTION_LIGHTLED(), LightManager::setMode, &LightManager::single::instance()));
 #endif // LIGHT_ENABLED
 #ifdef FAN_BOX_PIN
-		OptionToggle<bool>  * option_fan         = new OptionToggle<bool>(option_size, MSG_OPTION_BOX_FAN(), FanManager::toogleState, &FanManager::single::instance());
+		OptionToggle<bool>  * option_fan         = pool_item(new OptionToggle<bool>(option_size, MSG_OPTION_BOX_FAN(), FanManager::toogleState, &FanManager::single::instance()));
 #endif // FAN_BOX_PIN
-		OptionToggle<bool>  * option_serial      = new OptionToggle<bool> (option_size, MSG_OPTION_SERIAL(), SerialManager::setState, &SerialManager::single::instance());
-		OptionLaunch * option_offset      = new OptionLaunch(option_size, MSG_OPTION_OFFSET());
+		OptionToggle<bool>  * option_serial      = pool_item(new OptionToggle<bool> (option_size, MSG_OPTION_SERIAL(), SerialManager::setState, &SerialManager::single::instance()));
+		OptionLaunch * option_offset      = pool_item(new OptionLaunch(option_size, MSG_OPTION_OFFSET()));
 		option_offset->add(screen_offset);
-		OptionLaunch * option_about       = new OptionLaunch(option_size, MSG_OPTION_INFO());
+		OptionLaunch * option_about       = pool_item(new OptionLaunch(option_size, MSG_OPTION_INFO()));
 		option_about->add(screen_info);
-		OptionLaunch * option_contact     = new OptionLaunch(option_size, MSG_OPTION_CONTACT());
+		OptionLaunch * option_contact     = pool_item(new OptionLaunch(option_size, MSG_OPTION_CONTACT()));
 		option_contact->add(screen_contact);
-		OptionLaunch * option_language    = new OptionLaunch(option_size, MSG_OPTION_LANGUAGE());
+		OptionLaunch * option_language    = pool_item(new OptionLaunch(option_size, MSG_OPTION_LANGUAGE()));
 		option_language->add(screen_settings_language);
-		OptionLaunch * option_reset       = new OptionLaunch(option_size, MSG_OPTION_RESET());
+		OptionLaunch * option_reset       = pool_item(new OptionLaunch(option_size, MSG_OPTION_RESET()));
 		option_reset->add(screen_reset_init);
-		OptionLaunch * option_stats       = new OptionLaunch(option_size, MSG_OPTION_STATS());
+		OptionLaunch * option_stats       = pool_item(new OptionLaunch(option_size, MSG_OPTION_STATS()));
 		option_stats->add(screen_view_stats);
 
-		ScreenSetting * local_view = new ScreenSetting(MSG_SCREEN_SETTINGS_TITLE());
+		ScreenSetting * local_view = pool_screen(new ScreenSetting(MSG_SCREEN_SETTINGS_TITLE()));
 		local_view->add(option_back);
 		local_view->add(option_autolevel);
 #ifdef LIGHT_ENABLED
@@ -632,37 +418,15 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_stepper()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, SteppersManager::disableAllSteppers);
-		local_view->add(screen_main);
-		return local_view;
-	}
-
-	static ScreenSwitch * make_screen_move_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, PrintManager::knownPosition);
-		local_view->add(screen_move);
-		local_view->add(screen_move_info);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_move_info()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_MOVE_INFO_TITLE(), MSG_SCREEN_MOVE_INFO_TEXT(), MSG_PUSH_TO_BACK(), do_nothing);
-		local_view->add(screen_main);
-		return local_view;
-	}
-
 	static ScreenMenu * make_screen_move()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_move_x = new Icon(icon_size, bits_x_axis_normal, bits_x_axis_focused, MSG_ICON_MOVE_X());
-		Icon * icon_move_y = new Icon(icon_size, bits_y_axis_normal, bits_y_axis_focused, MSG_ICON_MOVE_Y());
-		Icon * icon_move_z = new Icon(icon_size, bits_z_axis_normal, bits_z_axis_focused, MSG_ICON_MOVE_Z());
-		Icon * icon_move_e = new Icon(icon_size, bits_e_axis_normal, bits_e_axis_focused, MSG_ICON_MOVE_E());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_move_x = pool_item(new Icon(icon_size, bits_x_axis_normal, bits_x_axis_focused, MSG_ICON_MOVE_X()));
+		Icon * icon_move_y = pool_item(new Icon(icon_size, bits_y_axis_normal, bits_y_axis_focused, MSG_ICON_MOVE_Y()));
+		Icon * icon_move_z = pool_item(new Icon(icon_size, bits_z_axis_normal, bits_z_axis_focused, MSG_ICON_MOVE_Z()));
+		Icon * icon_move_e = pool_item(new Icon(icon_size, bits_e_axis_normal, bits_e_axis_focused, MSG_ICON_MOVE_E()));
 
-		ScreenMenu *  local_view = new ScreenMenu(MSG_SCREEN_MOVE_TITLE(), MSG_SCREEN_MOVE_TEXT());
+		ScreenMenu *  local_view = pool_screen(new ScreenMenu(MSG_SCREEN_MOVE_TITLE(), MSG_SCREEN_MOVE_TEXT()));
 		local_view->add(screen_main);
 		local_view->icon(icon_back);
 		local_view->add(screen_move_x);
@@ -676,20 +440,12 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenSwitch * make_screen_move_heat_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, action_check_preheat_temp);
-		local_view->add(screen_move_e);
-		local_view->add(screen_move_heat_confirm);
-		return local_view;
-	}
-
 	static ScreenMenu * make_screen_move_heat_confirm()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_MOVE_CONFIRM_TITLE(), MSG_SCREEN_MOVE_CONFIRM_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_MOVE_CONFIRM_TITLE(), MSG_SCREEN_MOVE_CONFIRM_TEXT()));
 		local_view->add(screen_move);
 		local_view->icon(icon_back);
 		local_view->add(screen_move_heat);
@@ -697,28 +453,21 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_move_heat()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_preheat);
-		local_view->add(screen_move_heating);
-		return local_view;
-	}
-
 	static ScreenAnimation<float> * make_screen_move_heating()
 	{
-		ScreenAnimation<float> * local_view = new ScreenAnimation<float>(MSG_SCREEN_MOVE_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenAnimation<float> * local_view = pool_screen(new ScreenAnimation<float>(MSG_SCREEN_MOVE_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_move_e);
 		return local_view;
 	}
 
 	static ScreenMenu * make_screen_move_x()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_move_10mm = new Icon(icon_size, bits_10mm_normal, bits_10mm_focused, MSG_ICON_MOVE_10MM());
-		Icon * icon_move_1mm = new Icon(icon_size, bits_1mm_normal, bits_1mm_focused, MSG_ICON_MOVE_1MM());
-		Icon * icon_move_01mm = new Icon(icon_size, bits_01mm_normal, bits_01mm_focused, MSG_ICON_MOVE_01MM());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_move_10mm = pool_item(new Icon(icon_size, bits_10mm_normal, bits_10mm_focused, MSG_ICON_MOVE_10MM()));
+		Icon * icon_move_1mm = pool_item(new Icon(icon_size, bits_1mm_normal, bits_1mm_focused, MSG_ICON_MOVE_1MM()));
+		Icon * icon_move_01mm = pool_item(new Icon(icon_size, bits_01mm_normal, bits_01mm_focused, MSG_ICON_MOVE_01MM()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_MOVE_X_TITLE(), MSG_SCREEN_MOVE_X_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_MOVE_X_TITLE(), MSG_SCREEN_MOVE_X_TEXT()));
 		local_view->add(screen_move);
 		local_view->icon(icon_back);
 		local_view->add(screen_move_x_10);
@@ -732,12 +481,12 @@ namespace ui
 
 	static ScreenMenu * make_screen_move_y()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_move_10mm = new Icon(icon_size, bits_10mm_normal, bits_10mm_focused, MSG_ICON_MOVE_10MM());
-		Icon * icon_move_1mm = new Icon(icon_size, bits_1mm_normal, bits_1mm_focused, MSG_ICON_MOVE_1MM());
-		Icon * icon_move_01mm = new Icon(icon_size, bits_01mm_normal, bits_01mm_focused, MSG_ICON_MOVE_01MM());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_move_10mm = pool_item(new Icon(icon_size, bits_10mm_normal, bits_10mm_focused, MSG_ICON_MOVE_10MM()));
+		Icon * icon_move_1mm = pool_item(new Icon(icon_size, bits_1mm_normal, bits_1mm_focused, MSG_ICON_MOVE_1MM()));
+		Icon * icon_move_01mm = pool_item(new Icon(icon_size, bits_01mm_normal, bits_01mm_focused, MSG_ICON_MOVE_01MM()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_MOVE_Y_TITLE(), MSG_SCREEN_MOVE_Y_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_MOVE_Y_TITLE(), MSG_SCREEN_MOVE_Y_TEXT()));
 		local_view->add(screen_move);
 		local_view->icon(icon_back);
 		local_view->add(screen_move_y_10);
@@ -751,12 +500,12 @@ namespace ui
 
 	static ScreenMenu * make_screen_move_z()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_move_10mm = new Icon(icon_size, bits_10mm_normal, bits_10mm_focused, MSG_ICON_MOVE_10MM());
-		Icon * icon_move_1mm = new Icon(icon_size, bits_1mm_normal, bits_1mm_focused, MSG_ICON_MOVE_1MM());
-		Icon * icon_move_01mm = new Icon(icon_size, bits_01mm_normal, bits_01mm_focused, MSG_ICON_MOVE_01MM());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_move_10mm = pool_item(new Icon(icon_size, bits_10mm_normal, bits_10mm_focused, MSG_ICON_MOVE_10MM()));
+		Icon * icon_move_1mm = pool_item(new Icon(icon_size, bits_1mm_normal, bits_1mm_focused, MSG_ICON_MOVE_1MM()));
+		Icon * icon_move_01mm = pool_item(new Icon(icon_size, bits_01mm_normal, bits_01mm_focused, MSG_ICON_MOVE_01MM()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_MOVE_Z_TITLE(), MSG_SCREEN_MOVE_Z_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_MOVE_Z_TITLE(), MSG_SCREEN_MOVE_Z_TEXT()));
 		local_view->add(screen_move);
 		local_view->icon(icon_back);
 		local_view->add(screen_move_z_10);
@@ -770,11 +519,11 @@ namespace ui
 
 	static ScreenMenu * make_screen_move_e()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_move_1mm = new Icon(icon_size, bits_1mm_normal, bits_1mm_focused, MSG_ICON_MOVE_1MM());
-		Icon * icon_move_01mm = new Icon(icon_size, bits_01mm_normal, bits_01mm_focused, MSG_ICON_MOVE_01MM());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_move_1mm = pool_item(new Icon(icon_size, bits_1mm_normal, bits_1mm_focused, MSG_ICON_MOVE_1MM()));
+		Icon * icon_move_01mm = pool_item(new Icon(icon_size, bits_01mm_normal, bits_01mm_focused, MSG_ICON_MOVE_01MM()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_MOVE_E_TITLE(), MSG_SCREEN_MOVE_E_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_MOVE_E_TITLE(), MSG_SCREEN_MOVE_E_TEXT()));
 		local_view->add(screen_move);
 		local_view->icon(icon_back);
 		local_view->add(screen_move_e_1);
@@ -786,99 +535,91 @@ namespace ui
 
 	static ScreenDynamicAxis<float> * make_screen_move_x_01()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_X_01MM_TITLE(), X_AXIS, X_MIN_POS, X_MAX_POS, 0.1, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_X_01MM_TITLE(), X_AXIS, X_MIN_POS, X_MAX_POS, 0.1, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenDynamicAxis<float> * make_screen_move_y_01()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Y_01MM_TITLE(), Y_AXIS, Y_MIN_POS, Y_MAX_POS, 0.1, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Y_01MM_TITLE(), Y_AXIS, Y_MIN_POS, Y_MAX_POS, 0.1, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenDynamicAxis<float> * make_screen_move_z_01()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Z_01MM_TITLE(), Z_AXIS, Z_MIN_POS, Z_MAX_POS, 0.1, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Z_01MM_TITLE(), Z_AXIS, Z_MIN_POS, Z_MAX_POS, 0.1, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenDynamicAxis<float> * make_screen_move_e_01()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_E_01MM_TITLE(), E_AXIS, -1E9, 1E9, 0.1, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_E_01MM_TITLE(), E_AXIS, -1E9, 1E9, 0.1, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenDynamicAxis<float> * make_screen_move_x_1()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_X_1MM_TITLE(), X_AXIS, X_MIN_POS, X_MAX_POS, 1, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_X_1MM_TITLE(), X_AXIS, X_MIN_POS, X_MAX_POS, 1, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenDynamicAxis<float> * make_screen_move_y_1()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Y_1MM_TITLE(), Y_AXIS, Y_MIN_POS, Y_MAX_POS, 1, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Y_1MM_TITLE(), Y_AXIS, Y_MIN_POS, Y_MAX_POS, 1, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenDynamicAxis<float> * make_screen_move_z_1()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Z_1MM_TITLE(), Z_AXIS, Z_MIN_POS, Z_MAX_POS, 1, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Z_1MM_TITLE(), Z_AXIS, Z_MIN_POS, Z_MAX_POS, 1, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenDynamicAxis<float> * make_screen_move_e_1()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_E_1MM_TITLE(), E_AXIS, -1E9, 1E9, 1, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_E_1MM_TITLE(), E_AXIS, -1E9, 1E9, 1, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenDynamicAxis<float> * make_screen_move_x_10()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_X_10MM_TITLE(), X_AXIS, X_MIN_POS, X_MAX_POS, 10, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_X_10MM_TITLE(), X_AXIS, X_MIN_POS, X_MAX_POS, 10, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenDynamicAxis<float> * make_screen_move_y_10()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Y_10MM_TITLE(), Y_AXIS, Y_MIN_POS, Y_MAX_POS, 10, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Y_10MM_TITLE(), Y_AXIS, Y_MIN_POS, Y_MAX_POS, 10, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenDynamicAxis<float> * make_screen_move_z_10()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Z_10MM_TITLE(), Z_AXIS, Z_MIN_POS, Z_MAX_POS, 10, action_move_axis_to);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_MOVE_Z_10MM_TITLE(), Z_AXIS, Z_MIN_POS, Z_MAX_POS, 10, action_move_axis_to));
 		local_view->add(screen_move);
 		return local_view;
 	}
 
 	static ScreenTemperature * make_screen_temperature_main()
 	{
-		ScreenTemperature * local_view = new ScreenTemperature(MSG_SCREEN_TEMP_TITLE(), MSG_PUSH_TO_CONFIRM(), temp::min_temp_cooling, temp::max_temp_operation, 10, temp::default_temp_change_filament, action_set_temperature);
+		ScreenTemperature * local_view = pool_screen(new ScreenTemperature(MSG_SCREEN_TEMP_TITLE(), MSG_PUSH_TO_CONFIRM(), temp::min_temp_cooling, temp::max_temp_operation, 10, temp::default_temp_change_filament, action_set_temperature));
 		local_view->add(screen_temperature_main_switch);
 		return local_view;
 	}
 
-	static ScreenSwitch * make_screen_temperature_main_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, action_check_cooling);
-		local_view->add(screen_cooling_main);
-		local_view->add(screen_heating_main);
-		return local_view;
-	}
-
 	static ScreenCooldown * make_screen_cooling_main()
 	{
-		ScreenCooldown * local_view = new ScreenCooldown(MSG_SCREEN_TEMP_HEATING_TITLE(), MSG_PUSH_TO_CONTINUE(), temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenCooldown * local_view = pool_screen(new ScreenCooldown(MSG_SCREEN_TEMP_HEATING_TITLE(), MSG_PUSH_TO_CONTINUE(), temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_main);
 		local_view->add(screen_main);
 		return local_view;
@@ -886,7 +627,7 @@ namespace ui
 
 	static ScreenAnimation<float> * make_screen_heating_main()
 	{
-		ScreenAnimation<float> * local_view = new ScreenAnimation<float>(MSG_SCREEN_TEMP_HEATING_TITLE(), MSG_PUSH_TO_CONTINUE(), ScreenAnimation<float>::GREATER_OR_EQUAL, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenAnimation<float> * local_view = pool_screen(new ScreenAnimation<float>(MSG_SCREEN_TEMP_HEATING_TITLE(), MSG_PUSH_TO_CONTINUE(), ScreenAnimation<float>::GREATER_OR_EQUAL, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_main);
 		local_view->add(screen_main);
 		return local_view;
@@ -894,31 +635,24 @@ namespace ui
 
 	static ScreenAbout * make_screen_info()
 	{
-		ScreenAbout * local_view = new ScreenAbout(MSG_SCREEN_INFO_TITLE(), NULL, MSG_PUSH_TO_BACK(), bits_logo_about);
-		local_view->add(screen_settings);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_contact()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_CONTACT_TITLE(), MSG_SCREEN_CONTACT_TEXT(), MSG_PUSH_TO_BACK(), do_nothing);
+		ScreenAbout * local_view = pool_screen(new ScreenAbout(MSG_SCREEN_INFO_TITLE(), NULL, MSG_PUSH_TO_BACK(), bits_logo_about));
 		local_view->add(screen_settings);
 		return local_view;
 	}
 
 	static ScreenLanguage * make_screen_settings_language()
 	{
-		ScreenLanguage * local_view = new ScreenLanguage(NULL, Language::EN);
+		ScreenLanguage * local_view = pool_screen(new ScreenLanguage(NULL, Language::EN));
 		local_view->add(screen_settings);
 		return local_view;
 	}
 
 	static ScreenMenu * make_screen_offset()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_OFFSET_INIT_TITLE(), MSG_SCREEN_OFFSET_INIT_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_OFFSET_INIT_TITLE(), MSG_SCREEN_OFFSET_INIT_TEXT()));
 		local_view->add(screen_settings);
 		local_view->icon(icon_back);
 		local_view->add(screen_offset_switch);
@@ -926,69 +660,26 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenSwitch * make_screen_offset_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, action_check_preheat_temp);
-		local_view->add(screen_offset_home);
-		local_view->add(screen_offset_preheat);
-		return local_view;
-	}
-
-	static ScreenAction<void> * make_screen_offset_preheat()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_preheat);
-		local_view->add(screen_offset_preheating);
-		return local_view;
-	}
-
 	static ScreenAnimation<float> * make_screen_offset_preheating()
 	{
-		ScreenAnimation<float> * local_view = new ScreenAnimation<float>(MSG_SCREEN_OFFSET_PREHEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenAnimation<float> * local_view = pool_screen(new ScreenAnimation<float>(MSG_SCREEN_OFFSET_PREHEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_offset_home);
 		return local_view;
 	}
 
-	static ScreenTransition * make_screen_offset_home()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_OFFSET_HOME_TITLE(), MSG_SCREEN_OFFSET_HOME_TEXT(), MSG_PLEASE_WAIT(), action_offset_homing);
-		local_view->add(screen_offset_calculate);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_offset_calculate()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_OFFSET_PLANE_TITLE(), MSG_SCREEN_OFFSET_PLANE_TEXT(), MSG_PLEASE_WAIT(), action_offset);
-		local_view->add(screen_offset_info);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_offset_info()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_OFFSET_INFO_TITLE(), MSG_SCREEN_OFFSET_INFO_TEXT(), MSG_PUSH_TO_CONTINUE(), do_nothing);
-		local_view->add(screen_offset_set);
-		return local_view;
-	}
-
 	static ScreenDynamicAxis<float> * make_screen_offset_set()
 	{
-		ScreenDynamicAxis<float> * local_view = new ScreenDynamicAxis<float>(MSG_SCREEN_OFFSET_SET_TITLE(), Z_AXIS, -5.0, 5.0, 0.02, action_set_offset, true);
+		ScreenDynamicAxis<float> * local_view = pool_screen(new ScreenDynamicAxis<float>(MSG_SCREEN_OFFSET_SET_TITLE(), Z_AXIS, -5.0, 5.0, 0.02, action_set_offset, true));
 		local_view->add(screen_offset_rest);
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_offset_rest()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_offset_rest);
-		local_view->add(screen_offset_finish);
-		return local_view;
-	}
-
 	static ScreenMenu * make_screen_offset_finish()
 	{
-		Icon * icon_retry = new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_retry = pool_item(new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_OFFSET_FINISH_TITLE(), MSG_SCREEN_OFFSET_FINISH_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_OFFSET_FINISH_TITLE(), MSG_SCREEN_OFFSET_FINISH_TEXT()));
 		local_view->add(screen_offset_home);
 		local_view->icon(icon_retry);
 		local_view->add(screen_offset_save);
@@ -996,51 +687,29 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_offset_save()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_save_offset);
-		local_view->add(screen_main);
-		return local_view;
-	}
-
-	static ScreenSwitch * make_screen_print_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, action_check_preheat_temp);
-		local_view->add(screen_print_prepare);
-		local_view->add(screen_print_preheat);
-		return local_view;
-	}
-
-	static ScreenAction<void> * make_screen_print_preheat()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_preheat);
-		local_view->add(screen_print_preheating);
-		return local_view;
-	}
-
 	static ScreenAnimation<float> * make_screen_print_preheating()
 	{
-		ScreenAnimation<float> * local_view = new ScreenAnimation<float>(MSG_SCREEN_PRINT_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenAnimation<float> * local_view = pool_screen(new ScreenAnimation<float>(MSG_SCREEN_PRINT_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_print_prepare);
 		return local_view;
 	}
 
 	static ScreenTransition * make_screen_print_prepare()
 	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_SD_LIST_TITLE(), NULL, MSG_PLEASE_WAIT(), PrintManager::startPrint, &PrintManager::single::instance());
+		ScreenTransition * local_view = pool_screen(new ScreenTransition(MSG_SCREEN_SD_LIST_TITLE(), NULL, MSG_PLEASE_WAIT(), PrintManager::startPrint, &PrintManager::single::instance()));
 		local_view->add(screen_print);
 		return local_view;
 	}
 
 	static ScreenPrint * make_screen_print()
 	{
-		IconStatus<PrinterState_t> * icon_play_pause = new IconStatus<PrinterState_t>(icon_size, bits_pause_normal, bits_pause_focused, bits_play_normal, bits_play_focused, MSG_ICON_PAUSE(), MSG_ICON_PLAY(), &PrintManager::single::instance());
-		Icon * icon_stop = new Icon(icon_size, bits_stop_normal, bits_stop_focused, MSG_ICON_STOP());
-		Icon * icon_change_filament = new Icon(icon_size, bits_change_filament_normal, bits_change_filament_focused, MSG_ICON_CHANGE_FILAMENT());
-		Icon * icon_change_speed = new Icon(icon_size, bits_change_speed_normal, bits_change_speed_focused, MSG_ICON_CHANGE_SPEED());
-		Icon * icon_temperature = new Icon(icon_size, bits_temperature_normal, bits_temperature_focused, MSG_ICON_TEMPERATURE());
+		IconStatus<PrinterState_t> * icon_play_pause = pool_item(new IconStatus<PrinterState_t>(icon_size, bits_pause_normal, bits_pause_focused, bits_play_normal, bits_play_focused, MSG_ICON_PAUSE(), MSG_ICON_PLAY(), &PrintManager::single::instance()));
+		Icon * icon_stop = pool_item(new Icon(icon_size, bits_stop_normal, bits_stop_focused, MSG_ICON_STOP()));
+		Icon * icon_change_filament = pool_item(new Icon(icon_size, bits_change_filament_normal, bits_change_filament_focused, MSG_ICON_CHANGE_FILAMENT()));
+		Icon * icon_change_speed = pool_item(new Icon(icon_size, bits_change_speed_normal, bits_change_speed_focused, MSG_ICON_CHANGE_SPEED()));
+		Icon * icon_temperature = pool_item(new Icon(icon_size, bits_temperature_normal, bits_temperature_focused, MSG_ICON_TEMPERATURE()));
 
-		ScreenPrint * local_view = new ScreenPrint(MSG_SCREEN_PRINT_PRINTING(), &temp::TemperatureManager::single::instance());
+		ScreenPrint * local_view = pool_screen(new ScreenPrint(MSG_SCREEN_PRINT_PRINTING(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_play_pause);
 		local_view->icon(icon_play_pause);
 		local_view->add(screen_stop_confirm);
@@ -1054,46 +723,25 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_print_action_complete()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_finish_print);
-		local_view->add(screen_print_complete);
-		return local_view;
-	}
-
 	static ScreenDialog<void> * make_screen_print_complete()
 	{
-		ScreenComplete * local_view = new ScreenComplete(MSG_SCREEN_PRINT_COMPLETE_TITLE(), MSG_SCREEN_PRINT_COMPLETE_TEXT(), MSG_PUSH_TO_CONTINUE(), PrintManager::completePrint());
+		ScreenComplete * local_view = pool_screen(new ScreenComplete(MSG_SCREEN_PRINT_COMPLETE_TITLE(), MSG_SCREEN_PRINT_COMPLETE_TEXT(), MSG_PUSH_TO_CONTINUE(), PrintManager::completePrint()));
 		local_view->add(screen_close_inactivity);
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_close_inactivity()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_close_inactivity);
-		local_view->add(screen_main);
-		return local_view;
-	}
-
 	static ScreenEmergency * make_screen_error_temperature()
 	{
-		ScreenEmergency * local_view = new ScreenEmergency(MSG_SCREEN_ERROR_TITLE(), MSG_SCREEN_ERROR_TEMPERATURE_TEXT(), MSG_SCREEN_EMERGENCY_BOX(), bits_emergency);
-		return local_view;
-	}
-
-	static ScreenAction<void> * make_screen_play_pause()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(MSG_SCREEN_PRINT_PAUSE(), PrintManager::togglePause);
-		local_view->add(screen_print);
+		ScreenEmergency * local_view = pool_screen(new ScreenEmergency(MSG_SCREEN_ERROR_TITLE(), MSG_SCREEN_ERROR_TEMPERATURE_TEXT(), MSG_SCREEN_EMERGENCY_BOX(), bits_emergency));
 		return local_view;
 	}
 
 	static ScreenFile * make_screen_stop_confirm()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenFile * local_view = new ScreenFile(MSG_SCREEN_STOP_CONFIRM_TITLE());
+		ScreenFile * local_view = pool_screen(new ScreenFile(MSG_SCREEN_STOP_CONFIRM_TITLE()));
 		local_view->add(screen_print);
 		local_view->icon(icon_back);
 		local_view->add(screen_stop_OK);
@@ -1101,26 +749,19 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_stop_OK()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, PrintManager::stopPrint);
-		local_view->add(screen_stop_info);
-		return local_view;
-	}
-
 	static ScreenStop * make_screen_stop_info()
 	{
-		ScreenStop * local_view = new ScreenStop(MSG_SCREEN_PRINT_STOP_TITLE(), MSG_SCREEN_PRINT_STOP_TEXT(), MSG_PUSH_TO_CONTINUE(), action_get_height(), PrintManager::printingTime());
+		ScreenStop * local_view = pool_screen(new ScreenStop(MSG_SCREEN_PRINT_STOP_TITLE(), MSG_SCREEN_PRINT_STOP_TEXT(), MSG_PUSH_TO_CONTINUE(), action_get_height(), PrintManager::printingTime()));
 		local_view->add(screen_main);
 		return local_view;
 	}
 
 	static ScreenMenu * make_screen_change_init()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_CHANGE_INIT_TITLE(), MSG_SCREEN_CHANGE_INIT_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_CHANGE_INIT_TITLE(), MSG_SCREEN_CHANGE_INIT_TEXT()));
 		local_view->add(screen_print);
 		local_view->icon(icon_back);
 		local_view->add(screen_change_pausing);
@@ -1128,83 +769,33 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenTransition * make_screen_change_pausing()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_CHANGE_PAUSE_TITLE(), MSG_SCREEN_CHANGE_PAUSE_TEXT(), MSG_PLEASE_WAIT(), PrintManager::pausePrint);
-		local_view->add(screen_change_select);
-		return local_view;
-	}
-
 	static ScreenSelector<void, uint16_t> * make_screen_change_select()
 	{
-		ScreenSelector<void, uint16_t> * local_view = new ScreenSelector<void, uint16_t>(MSG_SCREEN_CHANGE_SELECT_TITLE(), MSG_PUSH_TO_CONFIRM(), temp::min_temp_operation, temp::max_temp_operation, 1, temp::default_temp_change_filament, action_set_temperature);
+		ScreenSelector<void, uint16_t> * local_view = pool_screen(new ScreenSelector<void, uint16_t>(MSG_SCREEN_CHANGE_SELECT_TITLE(), MSG_PUSH_TO_CONFIRM(), temp::min_temp_operation, temp::max_temp_operation, 1, temp::default_temp_change_filament, action_set_temperature));
 		local_view->add(screen_change_heating);
 		return local_view;
 	}
 
 	static ScreenAnimation<float> * make_screen_change_heating()
 	{
-		ScreenAnimation<float> * local_view = new ScreenAnimation<float>(MSG_SCREEN_CHANGE_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenAnimation<float> * local_view = pool_screen(new ScreenAnimation<float>(MSG_SCREEN_CHANGE_HEATING_TITLE(), MSG_PLEASE_WAIT(), ScreenAnimation<float>::RANGE, temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_change_pause_switch);
 		return local_view;
 	}
 	
-	static ScreenSwitch * make_screen_change_pause_switch()
-	{
-		ScreenSwitch * local_view = new ScreenSwitch(NULL, action_check_pause_state);
-		local_view->add(screen_change_pullout_info);
-		local_view->add(screen_change_wait_pause);
-		return local_view;
-	}
-	
 	static ScreenTransition * make_screen_change_wait_pause()
 	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_CHANGE_WAIT_PAUSE_TITLE(), MSG_SCREEN_CHANGE_WAIT_PAUSE_TEXT(), MSG_PLEASE_WAIT(), do_nothing, &PrintManager::single::instance());
+		ScreenTransition * local_view = pool_screen(new ScreenTransition(MSG_SCREEN_CHANGE_WAIT_PAUSE_TITLE(), MSG_SCREEN_CHANGE_WAIT_PAUSE_TEXT(), MSG_PLEASE_WAIT(), do_nothing, &PrintManager::single::instance()));
 		local_view->add(screen_change_pullout_info);
 		return local_view;
 	}
 
-	static ScreenDialog<void> * make_screen_change_pullout_info()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_CHANGE_INFO1_TITLE(), MSG_SCREEN_CHANGE_INFO1_TEXT(), MSG_PUSH_TO_CONTINUE(), do_nothing);
-		local_view->add(screen_move_to_change);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_move_to_change()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_MOVE_TO_CHANGE_TITLE(), MSG_SCREEN_MOVE_TO_CHANGE_TEXT(), MSG_PLEASE_WAIT(), action_move_to_filament_change);
-		local_view->add(screen_change_unloading);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_change_unloading()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_CHANGE_UNLOAD_TITLE(), MSG_SCREEN_CHANGE_UNLOAD_TEXT(), MSG_PLEASE_WAIT(), action_filament_unload);
-		local_view->add(screen_change_insert_info);
-		return local_view;
-	}
-
-	static ScreenDialog<void> * make_screen_change_insert_info()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_CHANGE_INFO2_TITLE(), MSG_SCREEN_CHANGE_INFO2_TEXT(), MSG_PUSH_TO_CONTINUE(), do_nothing);
-		local_view->add(screen_change_loading);
-		return local_view;
-	}
-
-	static ScreenTransition * make_screen_change_loading()
-	{
-		ScreenTransition * local_view = new ScreenTransition(MSG_SCREEN_CHANGE_LOAD_TITLE(), MSG_SCREEN_CHANGE_LOAD_TEXT(), MSG_PLEASE_WAIT(), action_filament_load);
-		local_view->add(screen_change_confirm);
-		return local_view;
-	}
-
 	static ScreenMenu * make_screen_change_confirm()
 	{
-		Icon * icon_retry = new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_retry = pool_item(new Icon(icon_size, bits_retry_normal, bits_retry_focused, MSG_ICON_RETRY()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_CHANGE_CONFIRM_TITLE(), MSG_SCREEN_CHANGE_CONFIRM_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_CHANGE_CONFIRM_TITLE(), MSG_SCREEN_CHANGE_CONFIRM_TEXT()));
 		local_view->add(screen_change_pullout_info);
 		local_view->icon(icon_retry);
 		local_view->add(screen_change_ok2print);
@@ -1212,46 +803,39 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_change_ok2print()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, PrintManager::resumePrint);
-		local_view->add(screen_print);
-		return local_view;
-	}
-
 	static ScreenDynamicFeedrate<uint16_t> * make_screen_speed()
 	{
-		ScreenDynamicFeedrate<uint16_t> * local_view = new ScreenDynamicFeedrate<uint16_t>(MSG_SCREEN_SPEED_TITLE(), 10, 400, 10, action_set_feedrate_multiply);
+		ScreenDynamicFeedrate<uint16_t> * local_view = pool_screen(new ScreenDynamicFeedrate<uint16_t>(MSG_SCREEN_SPEED_TITLE(), 10, 400, 10, action_set_feedrate_multiply));
 		local_view->add(screen_print);
 		return local_view;
 	}
 
 	static ScreenSelector<void, uint16_t> * make_screen_temperature_print()
 	{
-		ScreenSelector<void, uint16_t> * local_view = new ScreenSelector<void, uint16_t>(MSG_SCREEN_TEMP_TITLE(), MSG_PUSH_TO_CONFIRM(), temp::min_temp_operation, temp::max_temp_operation, 1, temp::TemperatureManager::single::instance().getTargetTemperature(), action_set_temperature);
+		ScreenSelector<void, uint16_t> * local_view = pool_screen(new ScreenSelector<void, uint16_t>(MSG_SCREEN_TEMP_TITLE(), MSG_PUSH_TO_CONFIRM(), temp::min_temp_operation, temp::max_temp_operation, 1, temp::TemperatureManager::single::instance().getTargetTemperature(), action_set_temperature));
 		local_view->add(screen_print);
 		return local_view;
 	}
 
 	static ScreenSerial * make_screen_serial()
 	{
-		ScreenSerial * local_view = new ScreenSerial(MSG_SCREEN_SERIAL_TITLE(), NULL);
+		ScreenSerial * local_view = pool_screen(new ScreenSerial(MSG_SCREEN_SERIAL_TITLE(), NULL));
 		return local_view;
 	}
 
 	static ScreenInactivity * make_screen_inactivity()
 	{
-		ScreenInactivity * local_view = new ScreenInactivity(NULL, MSG_PUSH_TO_BACK(), temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance());
+		ScreenInactivity * local_view = pool_screen(new ScreenInactivity(NULL, MSG_PUSH_TO_BACK(), temp::TemperatureManager::single::instance().getTargetTemperature(), &temp::TemperatureManager::single::instance()));
 		local_view->add(screen_main);
 		return local_view;
 	}
 
 	static ScreenMenu * make_screen_reset_init()
 	{
-		Icon * icon_back = new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK());
-		Icon * icon_ok = new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2());
+		Icon * icon_back = pool_item(new Icon(icon_size, bits_back_normal, bits_back_focused, MSG_BACK()));
+		Icon * icon_ok = pool_item(new Icon(icon_size, bits_ok_normal, bits_ok_focused, MSG_ICON_OK2()));
 
-		ScreenMenu * local_view = new ScreenMenu(MSG_SCREEN_RESET_INIT_TITLE(), MSG_SCREEN_RESET_INIT_TEXT());
+		ScreenMenu * local_view = pool_screen(new ScreenMenu(MSG_SCREEN_RESET_INIT_TITLE(), MSG_SCREEN_RESET_INIT_TEXT()));
 		local_view->add(screen_settings);
 		local_view->icon(icon_back);
 		local_view->add(screen_reset_info);
@@ -1259,29 +843,16 @@ namespace ui
 		return local_view;
 	}
 
-	static ScreenDialog<void> * make_screen_reset_info()
-	{
-		ScreenDialog<void> * local_view = new ScreenDialog<void>(MSG_SCREEN_RESET_INFO_TITLE(), MSG_SCREEN_RESET_INFO_TEXT(), MSG_PUSH_TO_CONTINUE(), do_nothing);
-		local_view->add(screen_reset);
-		return local_view;
-	}
-
 	static ScreenEmergency * make_screen_reset()
 	{
-		ScreenEmergency * local_view = new ScreenEmergency(MSG_SCREEN_RESET_TITLE(), MSG_SCREEN_RESET_TEXT(), MSG_PLEASE_WAIT(), bits_emergency);
+		ScreenEmergency * local_view = pool_screen(new ScreenEmergency(MSG_SCREEN_RESET_TITLE(), MSG_SCREEN_RESET_TEXT(), MSG_PLEASE_WAIT(), bits_emergency));
 		local_view->add(screen_resetting);
 		return local_view;
 	}
 
-	static ScreenAction<void> * make_screen_resetting()
-	{
-		ScreenAction<void> * local_view = new ScreenAction<void>(NULL, action_erase_EEPROM);
-		return local_view;
-	}
-	
 	static ScreenStats * make_screen_view_stats()
 	{
-		ScreenStats * local_view = new ScreenStats(MSG_SCREEN_VIEW_STATS_TITLE(), MSG_PUSH_TO_BACK());
+		ScreenStats * local_view = pool_screen(new ScreenStats(MSG_SCREEN_VIEW_STATS_TITLE(), MSG_PUSH_TO_BACK()));
 		local_view->add(screen_settings);
 		return local_view;
 	}
@@ -1289,17 +860,205 @@ namespace ui
 #ifdef BED_DETECTION
 	static ScreenError * make_screen_base_error()
 	{
-		ScreenError * local_view = new ScreenError(MSG_SCREEN_ERROR_TITLE(), MSG_SCREEN_BASE_ERROR_TEXT(), MSG_PUSH_TO_BACK(), bits_emergency);
+		ScreenError * local_view = pool_screen(new ScreenError(MSG_SCREEN_ERROR_TITLE(), MSG_SCREEN_BASE_ERROR_TEXT(), MSG_PUSH_TO_BACK(), bits_emergency));
 		local_view->add(screen_main);
 		return local_view;
 	}
 #endif // BED_DETECTION
 
+	////////////////////////////////
+	// Screens described in flash //
+	////////////////////////////////
+
+	// Actions, dialogs, transitions and switches only differ in their texts,
+	// their function and where they lead, so they are kept as records in
+	// flash and built by make_screen() instead of one function each.
+	struct ScreenRecord
+	{
+		typedef const char * (*Text)();
+		typedef void (*Function)();
+
+		typedef enum
+		{
+			ACTION = 0,
+			DIALOG,
+			TRANSITION,
+			SWITCH,
+		} Type_t;
+
+		uint8_t index;
+		uint8_t type;
+		Text title;
+		Text message;
+		Text box;
+		Function function;     // Functor<bool>::FuncPtr for a SWITCH
+		uint8_t next[2];       // screen_none if unused
+	};
+
+	#define ACTION_RECORD(index, title, action, next) \
+		{ index, ScreenRecord::ACTION, title, NULL, NULL, action, { next, screen_none } }
+	#define DIALOG_RECORD(index, title, message, box, action, next) \
+		{ index, ScreenRecord::DIALOG, title, message, box, action, { next, screen_none } }
+	#define TRANSITION_RECORD(index, title, message, box, action, next) \
+		{ index, ScreenRecord::TRANSITION, title, message, box, action, { next, screen_none } }
+	#define SWITCH_RECORD(index, check, next_true, next_false) \
+		{ index, ScreenRecord::SWITCH, NULL, NULL, NULL, \
+		  reinterpret_cast<ScreenRecord::Function>(static_cast<Functor<bool>::FuncPtr>(check)), { next_true, next_false } }
+
+	static const ScreenRecord screen_records[] PROGMEM =
+	{
+		// Initial wizard
+		ACTION_RECORD(screen_wizard_init, NULL, action_wizard_init, screen_wizard_language),
+		SWITCH_RECORD(screen_wizard_switch, action_check_wizard, screen_wizard_step3, screen_wizard_step1),
+		DIALOG_RECORD(screen_wizard_step1, MSG_SCREEN_WIZARD_TITLE, MSG_SCREEN_WIZARD_TEXT1, MSG_PUSH_TO_CONTINUE, do_nothing, screen_wizard_step2),
+		DIALOG_RECORD(screen_wizard_step2, MSG_SCREEN_WIZARD_TITLE, MSG_SCREEN_WIZARD_TEXT2, MSG_PUSH_TO_CONTINUE, do_nothing, screen_wizard_offset_home),
+		TRANSITION_RECORD(screen_wizard_offset_home, MSG_SCREEN_OFFSET_HOME_TITLE, MSG_SCREEN_OFFSET_HOME_TEXT, MSG_PLEASE_WAIT, action_offset_homing, screen_wizard_offset_calculate),
+		TRANSITION_RECORD(screen_wizard_offset_calculate, MSG_SCREEN_OFFSET_PLANE_TITLE, MSG_SCREEN_OFFSET_PLANE_TEXT, MSG_PLEASE_WAIT, action_offset, screen_wizard_offset_info),
+		DIALOG_RECORD(screen_wizard_offset_info, MSG_SCREEN_OFFSET_INFO_TITLE, MSG_SCREEN_OFFSET_INFO_TEXT, MSG_PUSH_TO_CONTINUE, do_nothing, screen_wizard_offset_set),
+		ACTION_RECORD(screen_wizard_offset_rest, NULL, action_offset_rest, screen_wizard_offset_finish),
+		ACTION_RECORD(screen_wizard_offset_save, NULL, action_save_offset, screen_wizard_step3),
+		DIALOG_RECORD(screen_wizard_step3, MSG_SCREEN_WIZARD_TITLE, MSG_SCREEN_WIZARD_TEXT3, MSG_PUSH_TO_CONTINUE, do_nothing, screen_wizard_step4),
+		DIALOG_RECORD(screen_wizard_step4, MSG_SCREEN_WIZARD_TITLE, MSG_SCREEN_WIZARD_TEXT4, MSG_PUSH_TO_FINISH, do_nothing, screen_wizard_finish),
+		ACTION_RECORD(screen_wizard_finish, NULL, action_wizard_finish, screen_main),
+
+		// Unload filament
+		SWITCH_RECORD(screen_unload_switch, PrintManager::knownPosition, screen_move_to_unload, screen_unload_home),
+		TRANSITION_RECORD(screen_unload_home, MSG_SCREEN_UNLOAD_HOME_TITLE, MSG_SCREEN_UNLOAD_HOME_TEXT, MSG_PLEASE_WAIT, action_homing, screen_move_to_unload),
+		TRANSITION_RECORD(screen_move_to_unload, MSG_SCREEN_MOVE_TO_UNLOAD_TITLE, MSG_SCREEN_MOVE_TO_UNLOAD_TEXT, MSG_PLEASE_WAIT, gui_action_move_to_filament_change, screen_unload_info),
+		DIALOG_RECORD(screen_unload_info, MSG_SCREEN_UNLOAD_INFO_TITLE, MSG_SCREEN_UNLOAD_INFO_TEXT, MSG_PUSH_TO_START, do_nothing, screen_unloading),
+		TRANSITION_RECORD(screen_unloading, MSG_SCREEN_UNLOADING_TITLE, MSG_SCREEN_UNLOADING_TEXT, MSG_PLEASE_WAIT, gui_action_filament_unload, screen_unload_confirm),
+		ACTION_RECORD(screen_unload_rest, NULL, action_move_to_rest, screen_main),
+
+		// Load filament
+		SWITCH_RECORD(screen_load_switch, PrintManager::knownPosition, screen_move_to_load, screen_load_home),
+		TRANSITION_RECORD(screen_load_home, MSG_SCREEN_LOAD_HOME_TITLE, MSG_SCREEN_LOAD_HOME_TEXT, MSG_PLEASE_WAIT, action_homing, screen_move_to_load),
+		TRANSITION_RECORD(screen_move_to_load, MSG_SCREEN_MOVE_TO_LOAD_TITLE, MSG_SCREEN_MOVE_TO_LOAD_TEXT, MSG_PLEASE_WAIT, gui_action_move_to_filament_change, screen_load_info),
+		DIALOG_RECORD(screen_load_info, MSG_SCREEN_LOAD_INFO_TITLE, MSG_SCREEN_LOAD_INFO_TEXT, MSG_PUSH_TO_START, do_nothing, screen_loading),
+		TRANSITION_RECORD(screen_loading, MSG_SCREEN_LOADING_TITLE, MSG_SCREEN_LOADING_TEXT, MSG_PLEASE_WAIT, gui_action_filament_load, screen_load_confirm),
+		ACTION_RECORD(screen_load_rest, NULL, action_move_to_rest, screen_main),
+
+		// Level plate
+		SWITCH_RECORD(screen_level_switch_preheat, action_check_preheat_temp, screen_level_switch, screen_level_preheat),
+		ACTION_RECORD(screen_level_preheat, NULL, action_preheat, screen_level_preheating),
+		SWITCH_RECORD(screen_level_switch, PrintManager::knownPosition, screen_level1, screen_level_homing),
+		TRANSITION_RECORD(screen_level_homing, MSG_SCREEN_LEVEL_HOMING_TITLE, MSG_SCREEN_LEVEL_HOMING_TEXT, MSG_PLEASE_WAIT, action_homing, screen_level1),
+		DIALOG_RECORD(screen_level1, MSG_SCREEN_LEVEL1_TITLE, MSG_SCREEN_LEVEL1_TEXT, MSG_PUSH_TO_CONTINUE, gui_action_level_plate, screen_level2),
+		DIALOG_RECORD(screen_level2, MSG_SCREEN_LEVEL2_TITLE, MSG_SCREEN_LEVEL2_TEXT, MSG_PUSH_TO_CONTINUE, gui_action_level_plate, screen_level3),
+		DIALOG_RECORD(screen_level3, MSG_SCREEN_LEVEL3_TITLE, MSG_SCREEN_LEVEL3_TEXT, MSG_PUSH_TO_CONTINUE, gui_action_level_plate, screen_level4),
+		ACTION_RECORD(screen_level4, NULL, action_level_plate, screen_level_z_homing),
+		TRANSITION_RECORD(screen_level_z_homing, MSG_SCREEN_LEVEL_HOMING_TITLE, MSG_SCREEN_LEVEL_HOMING_TEXT, MSG_PLEASE_WAIT, gui_action_z_homing, screen_level_confirm),
+
+		// Auto home
+		SWITCH_RECORD(screen_autohome_switch, action_check_preheat_temp, screen_autohome_homing, screen_autohome_heating),
+		ACTION_RECORD(screen_autohome_heating, NULL, action_preheat, screen_autohome_animation),
+		TRANSITION_RECORD(screen_autohome_homing, MSG_SCREEN_AUTOHOME_HOMING_TITLE, MSG_SCREEN_AUTOHOME_HOMING_TEXT, MSG_PLEASE_WAIT, gui_action_homing, screen_main),
+
+		// Steppers
+		ACTION_RECORD(screen_stepper, NULL, SteppersManager::disableAllSteppers, screen_main),
+
+		// Move Axis
+		SWITCH_RECORD(screen_move_switch, PrintManager::knownPosition, screen_move, screen_move_info),
+		DIALOG_RECORD(screen_move_info, MSG_SCREEN_MOVE_INFO_TITLE, MSG_SCREEN_MOVE_INFO_TEXT, MSG_PUSH_TO_BACK, do_nothing, screen_main),
+		SWITCH_RECORD(screen_move_heat_switch, action_check_preheat_temp, screen_move_e, screen_move_heat_confirm),
+		ACTION_RECORD(screen_move_heat, NULL, action_preheat, screen_move_heating),
+
+		// Temperature
+		SWITCH_RECORD(screen_temperature_main_switch, action_check_cooling, screen_cooling_main, screen_heating_main),
+
+		// Contact
+		DIALOG_RECORD(screen_contact, MSG_SCREEN_CONTACT_TITLE, MSG_SCREEN_CONTACT_TEXT, MSG_PUSH_TO_BACK, do_nothing, screen_settings),
+
+		// Offset
+		SWITCH_RECORD(screen_offset_switch, action_check_preheat_temp, screen_offset_home, screen_offset_preheat),
+		ACTION_RECORD(screen_offset_preheat, NULL, action_preheat, screen_offset_preheating),
+		TRANSITION_RECORD(screen_offset_home, MSG_SCREEN_OFFSET_HOME_TITLE, MSG_SCREEN_OFFSET_HOME_TEXT, MSG_PLEASE_WAIT, action_offset_homing, screen_offset_calculate),
+		TRANSITION_RECORD(screen_offset_calculate, MSG_SCREEN_OFFSET_PLANE_TITLE, MSG_SCREEN_OFFSET_PLANE_TEXT, MSG_PLEASE_WAIT, action_offset, screen_offset_info),
+		DIALOG_RECORD(screen_offset_info, MSG_SCREEN_OFFSET_INFO_TITLE, MSG_SCREEN_OFFSET_INFO_TEXT, MSG_PUSH_TO_CONTINUE, do_nothing, screen_offset_set),
+		ACTION_RECORD(screen_offset_rest, NULL, action_offset_rest, screen_offset_finish),
+		ACTION_RECORD(screen_offset_save, NULL, action_save_offset, screen_main),
+
+		// Print menu and control
+		SWITCH_RECORD(screen_print_switch, action_check_preheat_temp, screen_print_prepare, screen_print_preheat),
+		ACTION_RECORD(screen_print_preheat, NULL, action_preheat, screen_print_preheating),
+		ACTION_RECORD(screen_print_action_complete, NULL, action_finish_print, screen_print_complete),
+		ACTION_RECORD(screen_close_inactivity, NULL, action_close_inactivity, screen_main),
+		ACTION_RECORD(screen_play_pause, MSG_SCREEN_PRINT_PAUSE, PrintManager::togglePause, screen_print),
+		ACTION_RECORD(screen_stop_OK, NULL, PrintManager::stopPrint, screen_stop_info),
+
+		// Change filament
+		TRANSITION_RECORD(screen_change_pausing, MSG_SCREEN_CHANGE_PAUSE_TITLE, MSG_SCREEN_CHANGE_PAUSE_TEXT, MSG_PLEASE_WAIT, PrintManager::pausePrint, screen_change_select),
+		SWITCH_RECORD(screen_change_pause_switch, action_check_pause_state, screen_change_pullout_info, screen_change_wait_pause),
+		DIALOG_RECORD(screen_change_pullout_info, MSG_SCREEN_CHANGE_INFO1_TITLE, MSG_SCREEN_CHANGE_INFO1_TEXT, MSG_PUSH_TO_CONTINUE, do_nothing, screen_move_to_change),
+		TRANSITION_RECORD(screen_move_to_change, MSG_SCREEN_MOVE_TO_CHANGE_TITLE, MSG_SCREEN_MOVE_TO_CHANGE_TEXT, MSG_PLEASE_WAIT, gui_action_move_to_filament_change, screen_change_unloading),
+		TRANSITION_RECORD(screen_change_unloading, MSG_SCREEN_CHANGE_UNLOAD_TITLE, MSG_SCREEN_CHANGE_UNLOAD_TEXT, MSG_PLEASE_WAIT, gui_action_filament_unload, screen_change_insert_info),
+		DIALOG_RECORD(screen_change_insert_info, MSG_SCREEN_CHANGE_INFO2_TITLE, MSG_SCREEN_CHANGE_INFO2_TEXT, MSG_PUSH_TO_CONTINUE, do_nothing, screen_change_loading),
+		TRANSITION_RECORD(screen_change_loading, MSG_SCREEN_CHANGE_LOAD_TITLE, MSG_SCREEN_CHANGE_LOAD_TEXT, MSG_PLEASE_WAIT, gui_action_filament_load, screen_change_confirm),
+		ACTION_RECORD(screen_change_ok2print, NULL, PrintManager::resumePrint, screen_print),
+
+		// Reset EEPROM
+		DIALOG_RECORD(screen_reset_info, MSG_SCREEN_RESET_INFO_TITLE, MSG_SCREEN_RESET_INFO_TEXT, MSG_PUSH_TO_CONTINUE, do_nothing, screen_reset),
+		ACTION_RECORD(screen_resetting, NULL, action_erase_EEPROM, screen_none),
+	};
+
+	#undef ACTION_RECORD
+	#undef DIALOG_RECORD
+	#undef TRANSITION_RECORD
+	#undef SWITCH_RECORD
+
+	static const char * record_text(ScreenRecord::Text text)
+	{
+		return (text != NULL) ? text() : NULL;
+	}
+
+	static Screen * make_screen(ScreenIndex_t const & screen_index)
+	{
+		ScreenRecord record;
+		uint8_t i = 0;
+
+		while (pgm_read_byte(&screen_records[i].index) != screen_index)
+		{
+			if (++i == sizeof(screen_records) / sizeof(screen_records[0]))
+			{
+				return NULL;
+			}
+		}
+		memcpy_P(&record, &screen_records[i], sizeof(record));
+
+		Screen * local_view = NULL;
+		switch (record.type)
+		{
+			case ScreenRecord::ACTION:
+				local_view = pool_screen(new ScreenAction<void>(record_text(record.title), record.function));
+				break;
+			case ScreenRecord::DIALOG:
+				local_view = pool_screen(new ScreenDialog<void>(record_text(record.title), record_text(record.message), record_text(record.box), record.function));
+				break;
+			case ScreenRecord::TRANSITION:
+				local_view = pool_screen(new ScreenTransition(record_text(record.title), record_text(record.message), record_text(record.box), record.function));
+				break;
+			case ScreenRecord::SWITCH:
+				local_view = pool_screen(new ScreenSwitch(NULL, reinterpret_cast<Functor<bool>::FuncPtr>(record.function)));
+				break;
+		}
+
+		for (i = 0; i < 2 && record.next[i] != screen_none; i++)
+		{
+			local_view->add(static_cast<ScreenIndex_t>(record.next[i]));
+		}
+		return local_view;
+	}
+
 	Screen * new_view;
 
 	// Build the UI
 	Screen * GuiBuild(ScreenIndex_t const & screen_index)
 	{
+		new_view = make_screen(screen_index);
+		if (new_view != NULL)
+		{
+			return new_view;
+		}
+
 		switch (screen_index)
 		{
 			// Splash
@@ -1308,51 +1067,15 @@ namespace ui
 				break;
 
 			//Initial wizard
-			case screen_wizard_init:
-				new_view = make_screen_wizard_init();
-				break;
 			case screen_wizard_language:
 				new_view = make_screen_wizard_language();
 				break;
-			case screen_wizard_switch:
-				new_view = make_screen_wizard_switch();
-				break;
-			case screen_wizard_step1:
-				new_view = make_screen_wizard_step1();
-				break;
-			case screen_wizard_step2:
-				new_view = make_screen_wizard_step2();
-				break;
-			case screen_wizard_offset_home:
-				new_view = make_screen_wizard_offset_home();
-				break;
-			case screen_wizard_offset_calculate:
-				new_view = make_screen_wizard_offset_calculate();
-				break;
-			case screen_wizard_offset_info:
-				new_view = make_screen_wizard_offset_info();
-				break;
 			case screen_wizard_offset_set:
 				new_view = make_screen_wizard_offset_set();
 				break;
-			case screen_wizard_offset_rest:
-				new_view = make_screen_wizard_offset_rest();
-				break;
 			case screen_wizard_offset_finish:
 				new_view = make_screen_wizard_offset_finish();
 				break;
-			case screen_wizard_offset_save:
-				new_view = make_screen_wizard_offset_save();
-				break;
-			case screen_wizard_step3:
-				new_view = make_screen_wizard_step3();
-				break;
-			case screen_wizard_step4:
-				new_view = make_screen_wizard_step4();
-				break;
-			case screen_wizard_finish:
-				new_view = make_screen_wizard_finish();
-				break;
 
 			// Emergency stop
 			case screen_emergency:
@@ -1363,15 +1086,9 @@ namespace ui
 			case screen_reset_init:
 				new_view = make_screen_reset_init();
 				break;
-			case screen_reset_info:
-				new_view = make_screen_reset_info();
-				break;
 			case screen_reset:
 				new_view = make_screen_reset();
 				break;
-			case screen_resetting:
-				new_view = make_screen_resetting();
-				break;
 
 			// Main menu
 			case screen_main:
@@ -1399,27 +1116,9 @@ namespace ui
 			case screen_unload_heating:
 				new_view = make_screen_unload_heating();
 				break;
-			case screen_unload_switch:
-				new_view = make_screen_unload_switch();
-				break;
-			case screen_unload_home:
-				new_view = make_screen_unload_home();
-				break;
-			case screen_move_to_unload:
-				new_view = make_screen_move_to_unload();
-				break;
-			case screen_unload_info:
-				new_view = make_screen_unload_info();
-				break;
-			case screen_unloading:
-				new_view = make_screen_unloading();
-				break;
 			case screen_unload_confirm:
 				new_view = make_screen_unload_confirm();
 				break;
-			case screen_unload_rest:
-				new_view = make_screen_unload_rest();
-				break;
 
 			// Load filament
 			case screen_load_init:
@@ -1431,62 +1130,17 @@ namespace ui
 			case screen_load_heating:
 				new_view = make_screen_load_heating();
 				break;
-			case screen_load_switch:
-				new_view = make_screen_load_switch();
-				break;
-			case screen_load_home:
-				new_view = make_screen_load_home();
-				break;
-			case screen_move_to_load:
-				new_view = make_screen_move_to_load();
-				break;
-			case screen_load_info:
-				new_view = make_screen_load_info();
-				break;
-			case screen_loading:
-				new_view = make_screen_loading();
-				break;
 			case screen_load_confirm:
 				new_view = make_screen_load_confirm();
 				break;
-			case screen_load_rest:
-				new_view = make_screen_load_rest();
-				break;
 
 			// Level plate
 			case screen_level_init:
 				new_view = make_screen_level_init();
 				break;
-			case screen_level_switch_preheat:
-				new_view = make_screen_level_switch_preheat();
-				break;
-			case screen_level_preheat:
-				new_view = make_screen_level_preheat();
-				break;
 			case screen_level_preheating:
 				new_view = make_screen_level_preheating();
 				break;
-			case screen_level_switch:
-				new_view = make_screen_level_switch();
-				break;
-			case screen_level_homing:
-				new_view = make_screen_level_homing();
-				break;
-			case screen_level1:
-				new_view = make_screen_level1();
-				break;
-			case screen_level2:
-				new_view = make_screen_level2();
-				break;
-			case screen_level3:
-				new_view = make_screen_level3();
-				break;
-			case screen_level4:
-				new_view = make_screen_level4();
-				break;
-			case screen_level_z_homing:
-				new_view = make_screen_level_z_homing();
-				break;
 			case screen_level_confirm:
 				new_view = make_screen_level_confirm();
 				break;
@@ -1495,33 +1149,16 @@ namespace ui
 			case screen_autohome_init:
 				new_view = make_screen_autohome_init();
 				break;
-			case screen_autohome_switch:
-				new_view = make_screen_autohome_switch();
-				break;
-			case screen_autohome_heating:
-				new_view = make_screen_autohome_heating();
-				break;
-
 			case screen_autohome_animation:
 				new_view = make_screen_autohome_animation();
 				break;
 
-			case screen_autohome_homing:
-				new_view = make_screen_autohome_homing();
-				break;
-
 			// Settings
 			case screen_settings:
 				new_view = make_screen_settings();
 				break;
 
 			// Move Axis
-			case screen_move_switch:
-				new_view = make_screen_move_switch();
-				break;
-			case screen_move_info:
-				new_view = make_screen_move_info();
-				break;
 			case screen_move:
 				new_view = make_screen_move();
 				break;
@@ -1570,31 +1207,17 @@ namespace ui
 			case screen_move_z_10:
 				new_view = make_screen_move_z_10();
 				break;
-			case screen_move_heat_switch:
-				new_view = make_screen_move_heat_switch();
-				break;
 			case screen_move_heat_confirm:
 				new_view = make_screen_move_heat_confirm();
 				break;
-			case screen_move_heat:
-				new_view = make_screen_move_heat();
-				break;
 			case screen_move_heating:
 				new_view = make_screen_move_heating();
 				break;
 
-			// Steppers
-			case screen_stepper:
-				new_view = make_screen_stepper();
-				break;
-
 			// Temperature
 			case screen_temperature_main:
 				new_view = make_screen_temperature_main();
 				break;
-			case screen_temperature_main_switch:
-				new_view = make_screen_temperature_main_switch();
-				break;
 			case screen_cooling_main:
 				new_view = make_screen_cooling_main();
 				break;
@@ -1606,10 +1229,6 @@ namespace ui
 			case screen_info:
 				new_view = make_screen_info();
 				break;
-			// Contact
-			case screen_contact:
-				new_view = make_screen_contact();
-				break;
 
 			//Language
 			case screen_settings_language:
@@ -1620,44 +1239,17 @@ namespace ui
 			case screen_offset:
 				new_view = make_screen_offset();
 				break;
-			case screen_offset_switch:
-				new_view = make_screen_offset_switch();
-				break;
-			case screen_offset_preheat:
-				new_view = make_screen_offset_preheat();
-				break;
 			case screen_offset_preheating:
 				new_view = make_screen_offset_preheating();
 				break;
-			case screen_offset_home:
-				new_view = make_screen_offset_home();
-				break;
-			case screen_offset_calculate:
-				new_view = make_screen_offset_calculate();
-				break;
-      		case screen_offset_info:
-				new_view = make_screen_offset_info();
-				break;
       		case screen_offset_set:
 				new_view = make_screen_offset_set();
 				break;
-			case screen_offset_rest:
-				new_view = make_screen_offset_rest();
-				break;
       		case screen_offset_finish:
 				new_view = make_screen_offset_finish();
 				break;
-      		case screen_offset_save:
-				new_view = make_screen_offset_save();
-				break;
 
 			// Print menu and control
-			case screen_print_switch:
-				new_view = make_screen_print_switch();
-				break;
-			case screen_print_preheat:
-				new_view = make_screen_print_preheat();
-				break;
 			case screen_print_preheating:
 				new_view = make_screen_print_preheating();
 				break;
@@ -1667,21 +1259,12 @@ namespace ui
 			case screen_print:
 				new_view = make_screen_print();
 				break;
-			case screen_print_action_complete:
-				new_view = make_screen_print_action_complete();
-				break;
 			case screen_print_complete:
 				new_view = make_screen_print_complete();
 				break;
-			case screen_play_pause:
-				new_view = make_screen_play_pause();
-				break;
 			case screen_stop_confirm:
 				new_view = make_screen_stop_confirm();
 				break;
-			case screen_stop_OK:
-				new_view = make_screen_stop_OK();
-				break;
 			case screen_stop_info:
 				new_view = make_screen_stop_info();
 				break;
@@ -1690,42 +1273,18 @@ namespace ui
 			case screen_change_init:
 				new_view = make_screen_change_init();
 				break;
-			case screen_change_pausing:
-				new_view = make_screen_change_pausing();
-				break;
 			case screen_change_select:
 				new_view = make_screen_change_select();
 				break;
 			case screen_change_heating:
 				new_view = make_screen_change_heating();
 				break;
-			case screen_change_pause_switch:
-				new_view = make_screen_change_pause_switch();
-				break;
 			case screen_change_wait_pause:
 				new_view = make_screen_change_wait_pause();
 				break;
-			case screen_change_pullout_info:
-				new_view = make_screen_change_pullout_info();
-				break;
-			case screen_move_to_change:
-				new_view = make_screen_move_to_change();
-				break;
-			case screen_change_unloading:
-				new_view = make_screen_change_unloading();
-				break;
-			case screen_change_insert_info:
-				new_view = make_screen_change_insert_info();
-				break;
-			case screen_change_loading:
-				new_view = make_screen_change_loading();
-				break;
 			case screen_change_confirm:
 				new_view = make_screen_change_confirm();
 				break;
-			case screen_change_ok2print:
-				new_view = make_screen_change_ok2print();
-				break;
 
 			// Change speed
 			case screen_speed:
@@ -1746,9 +1305,6 @@ namespace ui
 			case screen_inactivity:
 				new_view = make_screen_inactivity();
 				break;
-			case screen_close_inactivity:
-				new_view = make_screen_close_inactivity();
-				break;
 
 			// Error screens
 			case screen_error_temperature:
@@ -1765,7 +1321,10 @@ namespace ui
 			case screen_view_stats:
 				new_view = make_screen_view_stats();
 				break;
-				
+
+			// The rest are in screen_records
+			default:
+				break;
 		}
 		return new_view; 
 	}
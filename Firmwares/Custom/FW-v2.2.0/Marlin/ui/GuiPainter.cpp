@@ -37,8 +37,12 @@ namespace ui
 {
 	GuiPainter::GuiPainter()
 		: m_impl(0)
+		, m_frame_time(0)
 	{
 		m_working_area = Area();
+#ifdef GUI_DRAW_STATS
+		resetDrawStats();
+#endif // GUI_DRAW_STATS
 	}
 
 	GuiPainter::~GuiPainter()
@@ -51,6 +55,18 @@ namespace ui
 
 	void GuiPainter::firstPage()
 	{
+		firstPage(Area());
+	}
+
+	//! Starts a frame that only draws and sends the given window of the
+	//! screen, so a widget is repainted without touching the rest. The
+	//! window is widened to the 16 pixel words the display is written in.
+	void GuiPainter::firstPage(Area window)
+	{
+		window.x_init &= ~0x0F;
+		window.x_end |= 0x0F;
+		m_window = window;
+		u8g_dev_st7920_128x64_rrd_window(window.x_init, window.y_init, window.x_end, window.y_end);
 		m_impl.firstPage();
 	}
 
@@ -61,9 +77,70 @@ namespace ui
 		coordinateXEnd(screen_width);
 		coordinateYEnd(screen_height);
 		clearWorkingArea();
-		m_impl.nextPage();
+		if (m_impl.nextPage())
+		{
+			return true;
+		}
+
+		// Frames started with firstPage() cover the whole screen again
+		m_window = Area();
+		u8g_dev_st7920_128x64_rrd_window(0, 0, screen_width - 1, screen_height - 1);
+		return false;
+	}
+
+	//! True if the area is inside the window of the current frame, at least
+	//! in part. Widgets outside of it don't need to be drawn.
+	bool GuiPainter::isVisible(Area const & area)
+	{
+		return area.x_init <= m_window.x_end && area.x_end >= m_window.x_init
+			&& area.y_init <= m_window.y_end && area.y_end >= m_window.y_init;
+	}
+
+#ifdef GUI_DRAW_STATS
+	void GuiPainter::recordDraw(uint32_t duration_us)
+	{
+		if (m_draw_count == 0xFFFF || m_draw_total_us > 0xFFFFFFFFUL - duration_us)
+		{
+			m_draw_count >>= 1;
+			m_draw_total_us >>= 1;
+		}
+
+		m_draw_count++;
+		m_draw_total_us += duration_us;
+		if (duration_us > m_draw_max_us)
+		{
+			m_draw_max_us = duration_us;
+		}
+	}
+
+	void GuiPainter::reportDrawStats()
+	{
+		uint32_t average_us = m_draw_count ? m_draw_total_us / m_draw_count : 0;
+
+		SERIAL_ECHO_START;
+		SERIAL_ECHOPGM("Print screen redraws n:");
+		SERIAL_ECHO(m_draw_count);
+		SERIAL_ECHOPGM(" avg:");
+		SERIAL_ECHO(average_us);
+		SERIAL_ECHOPGM("us (");
+		SERIAL_ECHO(average_us * clockCyclesPerMicrosecond());
+		SERIAL_ECHOPGM(" cycles) max:");
+		SERIAL_ECHO(m_draw_max_us);
+		SERIAL_ECHOPGM("us pages:");
+		SERIAL_ECHO(LCD_PIXEL_HEIGHT / PAGE_HEIGHT);
+		SERIAL_ECHOPGM(" last frame:");
+		SERIAL_ECHO(u8g_dev_st7920_128x64_rrd_frame_bytes);
+		SERIAL_ECHOLNPGM(" bytes");
 	}
 
+	void GuiPainter::resetDrawStats()
+	{
+		m_draw_count = 0;
+		m_draw_total_us = 0;
+		m_draw_max_us = 0;
+	}
+#endif // GUI_DRAW_STATS
+
 	void GuiPainter::clearWorkingArea()
 	{
 		m_working_area = Area();
@@ -561,6 +638,21 @@ namespace ui
 		m_animation_index = 0;
 	}
 
+	//! True at most once every GUI_FRAME_MS, whichever screen asks. Screens
+	//! only repaint their animations when it is, so they can't take more
+	//! of the main loop than that however often they are drawn.
+	bool GuiPainter::animationFrame()
+	{
+		uint32_t now = millis();
+		if (now - m_frame_time < GUI_FRAME_MS)
+		{
+			return false;
+		}
+
+		m_frame_time = now;
+		return true;
+	}
+
 	void GuiPainter::drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
 	{
 		m_impl.drawLine(x1, y1, x2, y2);
@@ -37,6 +37,11 @@
 // Specify the printer UI implementation
 #include "GuiImpl_witbox_2.h"
 
+// Shortest time between two frames of the screen animations
+#ifndef GUI_FRAME_MS
+	#define GUI_FRAME_MS 100
+#endif // GUI_FRAME_MS
+
 namespace ui
 {
 	struct Area
@@ -55,8 +60,8 @@ namespace ui
 			, y_end(y1)
 		{ }
 
-		uint8_t width() { return x_end - x_init + 1; }
-		uint8_t height() { return y_end - y_init + 1; }
+		uint8_t width() const { return x_end - x_init + 1; }
+		uint8_t height() const { return y_end - y_init + 1; }
 
 		uint8_t x_init;
 		uint8_t y_init;
@@ -89,7 +94,15 @@ namespace ui
 
 			void begin();
 			void firstPage();
+			void firstPage(Area window);
 			bool nextPage();
+			bool isVisible(Area const & area);
+
+#ifdef GUI_DRAW_STATS
+			void recordDraw(uint32_t duration_us);
+			void reportDrawStats();
+			void resetDrawStats();
+#endif // GUI_DRAW_STATS
 
 			void clearWorkingArea();
 			void setWorkingArea(Area a);
@@ -113,6 +126,7 @@ namespace ui
 
 			void animate(const char * text, uint8_t window, uint32_t delay_ms);
 			void animationReset(uint32_t timeout);
+			bool animationFrame();
 
 			void drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
 			void drawBox(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
@@ -146,6 +160,7 @@ namespace ui
 			uint8_t m_y_end;
 
 			Area m_working_area;
+			Area m_window;
 
 			char m_animation_index;
 			bool m_animation_dir;
@@ -153,6 +168,13 @@ namespace ui
 			bool m_animation_loop;
 			uint32_t m_current_update_time;
 			uint32_t m_previous_update_time;
+			uint32_t m_frame_time;
+
+#ifdef GUI_DRAW_STATS
+			uint16_t m_draw_count;
+			uint32_t m_draw_total_us;
+			uint32_t m_draw_max_us;
+#endif // GUI_DRAW_STATS
 	};
 }
 #define painter ui::GuiPainter::singleton::instance()
@@ -27,6 +27,7 @@
 
 #include "Icon.h"
 #include "GuiPainter.h"
+#include "ViewPool.h"
 
 namespace ui
 {
@@ -40,6 +41,16 @@ namespace ui
 	Icon::~Icon()
 	{ };
 
+	void * Icon::operator new(size_t size)
+	{
+		return ViewPool::allocate(size);
+	}
+
+	void Icon::operator delete(void * pointer)
+	{
+		ViewPool::release(pointer);
+	}
+
 	uint8_t const & Icon::width() const
 	{
 		return m_size.width;
@@ -28,6 +28,7 @@
 #ifndef ICON_H
 #define ICON_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace ui
@@ -49,6 +50,9 @@ namespace ui
 			Icon(Size const & size, const unsigned char * bitmap, const unsigned char * focused_bitmap = 0, const char * text = 0);
 			virtual ~Icon();
 
+			static void * operator new(size_t size);
+			static void operator delete(void * pointer);
+
 			uint8_t const & width() const;
 			uint8_t const & height() const;
 			virtual const char * text() const;
@@ -28,6 +28,7 @@
 #include "Option.h"
 
 #include "GuiPainter.h"
+#include "ViewPool.h"
 
 namespace ui
 {
@@ -39,6 +40,16 @@ namespace ui
 	Option::~Option()
 	{ };
 
+	void * Option::operator new(size_t size)
+	{
+		return ViewPool::allocate(size);
+	}
+
+	void Option::operator delete(void * pointer)
+	{
+		ViewPool::release(pointer);
+	}
+
 	uint8_t const & Option::width() const
 	{
 		return m_size.width;
@@ -28,6 +28,7 @@
 #ifndef OPTION
 #define OPTION
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace ui
@@ -52,6 +53,9 @@ namespace ui
 			Option(option::Size const & size, const char * text = 0);
 			virtual ~Option();
 
+			static void * operator new(size_t size);
+			static void operator delete(void * pointer);
+
 			uint8_t const & width() const;
 			uint8_t const & height() const;
 			virtual const char * text() const;
@@ -26,6 +26,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "Screen.h"
+#include "ViewPool.h"
 
 namespace ui
 {
@@ -38,6 +39,16 @@ namespace ui
 	Screen::~Screen()
 	{ }
 
+	void * Screen::operator new(size_t size)
+	{
+		return ViewPool::allocate(size);
+	}
+
+	void Screen::operator delete(void * pointer)
+	{
+		ViewPool::release(pointer);
+	}
+
 	const char * Screen::title() const
 	{
 		return m_title;
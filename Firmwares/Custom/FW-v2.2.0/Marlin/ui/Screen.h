@@ -57,9 +57,15 @@ namespace ui
 			Screen(const char * title = 0, ScreenType_t const & type = SIMPLE);
 			virtual ~Screen();
 
+			static void * operator new(size_t size);
+			static void operator delete(void * pointer);
+
 			const char * title() const;
 			ScreenType_t const & type() const;
 
+			//! A view asked for with ViewManager::activeView() from one of these
+			//! is built once the handler returns, so the calling view stays
+			//! valid until then.
 			virtual void left() {};
 			virtual void right() {};
 			virtual void press() {};
@@ -63,7 +63,17 @@ namespace ui
 			void update(T value);
 
 		protected:
-			bool isConditionMet();
+			// Parts of the screen repainted on their own when only they change,
+			// besides the progress bar that moves on every frame
+			typedef enum
+			{
+				VALUE_WIDGET = 0x01,
+			} Widget_t;
+
+			void refresh();
+			virtual void paint();
+			void paintProgress(uint8_t x, uint8_t y);
+			virtual bool isConditionMet();
 
 		protected:
 			const char * m_text;
@@ -75,9 +85,12 @@ namespace ui
 			uint8_t m_num_item_added;
 
 			Condition_t m_condition;
-			uint32_t m_previous_time;
-			uint32_t m_current_time;
 			uint8_t m_frame;
+
+			uint8_t m_dirty_widgets;
+			int16_t m_shown;          // value on the display
+			Area m_value_area;
+			Area m_progress_area;
 	};
 
 	template <typename T>
@@ -90,9 +103,11 @@ namespace ui
 		, m_back_screen(screen_none)
 		, m_condition(condition)
 		, m_target(target)
-		, m_previous_time(0)
-		, m_current_time(0)
 		, m_frame(0)
+		, m_dirty_widgets(0)
+		, m_shown(0)
+		, m_value_area(0, 24, screen_width - 1, 35)
+		, m_progress_area(8, 38, 119, 43)
 	{
 		this->connect();
 		lcd_disable_button();
@@ -111,82 +126,136 @@ namespace ui
 	template <typename T>
 		void ScreenAnimation<T>::draw()
 	{
-		char c_target[4] = { 0 };
-		snprintf(c_target, 4, "%d", m_target);
+		refresh();
+
+		if ( isConditionMet() )
+		{
+			lcd_enable_button();
+			ViewManager::getInstance().activeView(m_next_screen);
+		}
+	}
+
+	//! Repaints the screen whole the first time, and afterwards only the
+	//! value when the number shown changes and the progress bar when the
+	//! animation frame timer fires.
+	template <typename T>
+		void ScreenAnimation<T>::refresh()
+	{
+		if (painter.animationFrame() == false && m_needs_drawing == false)
+		{
+			return;
+		}
 
-		char c_current[4] = { 0 };
-		dtostrf(m_observed, 3, 0, c_current);
+		m_frame = (m_frame + 1) % 8;
 
-		//Check time for next progress bar frame
-		m_current_time = millis();
+		int16_t shown = round(m_observed);
+		if (shown != m_shown)
+		{
+			m_shown = shown;
+			m_dirty_widgets |= VALUE_WIDGET;
+		}
 
-		if(m_current_time >= m_previous_time + 100)
+		if (m_needs_drawing == true)
 		{
-			m_current_time = millis();
-			m_previous_time = m_current_time;
-			m_frame = (m_frame + 1) % 8;
+			m_needs_drawing = false;
 
 			painter.firstPage();
 			do
 			{
-				painter.title(m_title);
-				painter.box(m_text);
-
-				//Draw temperature
-				uint8_t y_init = painter.coordinateYInit();
-				uint8_t y_end = painter.coordinateYEnd();
-
-				painter.setColorIndex(1);
-				painter.setPrintPos(31,(y_end + y_init)/2 - 9/2 - 3);
-
-				painter.print(c_current);
-				painter.print("\xb0");
-				painter.print(" / ");
-				painter.print(c_target);
-				painter.print("\xb0");
-
-				//Draw progress bar
-				painter.setColorIndex(1);
-				painter.drawBox(8,38,112,6);
-				painter.setColorIndex(0);
-				painter.drawBox(9,39,110,4);
-				painter.setColorIndex(1);
-
-				switch(m_frame)
+				paint();
+			} while ( painter.nextPage() );
+		}
+		else
+		{
+			// The rest of the display is left as it is
+			if (m_dirty_widgets & VALUE_WIDGET)
+			{
+				painter.firstPage(m_value_area);
+				do
 				{
-					case 0:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_1);
-						break;
-					case 1:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_2);
-						break;
-					case 2:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_3);
-						break;
-					case 3:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_4);
-						break;
-					case 4:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_5);
-						break;
-					case 5:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_6);
-						break;
-					case 6:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_7);
-						break;
-					case 7:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_8);
-						break;
-				}
+					paint();
+				} while ( painter.nextPage() );
+			}
 
+			painter.firstPage(m_progress_area);
+			do
+			{
+				paint();
 			} while ( painter.nextPage() );
 		}
+		m_dirty_widgets = 0;
+	}
 
-		if ( isConditionMet() )
+	template <typename T>
+		void ScreenAnimation<T>::paint()
+	{
+		painter.title(m_title);
+		painter.box(m_text);
+
+		//Draw temperature
+		if (painter.isVisible(m_value_area))
 		{
-			lcd_enable_button();
-			ViewManager::getInstance().activeView(m_next_screen);
+			char c_target[4] = { 0 };
+			snprintf(c_target, 4, "%d", m_target);
+
+			char c_current[4] = { 0 };
+			dtostrf(m_observed, 3, 0, c_current);
+
+			uint8_t y_init = painter.coordinateYInit();
+			uint8_t y_end = painter.coordinateYEnd();
+
+			painter.setColorIndex(1);
+			painter.setPrintPos(31,(y_end + y_init)/2 - 9/2 - 3);
+
+			painter.print(c_current);
+			painter.print("\xb0");
+			painter.print(" / ");
+			painter.print(c_target);
+			painter.print("\xb0");
+		}
+
+		//Draw progress bar
+		paintProgress(m_progress_area.x_init, m_progress_area.y_init);
+	}
+
+	//! Draws the frame of the progress bar with its top left corner at x, y.
+	template <typename T>
+		void ScreenAnimation<T>::paintProgress(uint8_t x, uint8_t y)
+	{
+		painter.setColorIndex(1);
+		painter.drawBox(x, y, 112, 6);
+		painter.setColorIndex(0);
+		painter.drawBox(x + 1, y + 1, 110, 4);
+		painter.setColorIndex(1);
+
+		x += 2;
+		y += 2;
+		switch(m_frame)
+		{
+			case 0:
+				painter.drawBitmap(x, y, progress_width, progress_height, bits_progress_1);
+				break;
+			case 1:
+				painter.drawBitmap(x, y, progress_width, progress_height, bits_progress_2);
+				break;
+			case 2:
+				painter.drawBitmap(x, y, progress_width, progress_height, bits_progress_3);
+				break;
+			case 3:
+				painter.drawBitmap(x, y, progress_width, progress_height, bits_progress_4);
+				break;
+			case 4:
+				painter.drawBitmap(x, y, progress_width, progress_height, bits_progress_5);
+				break;
+			case 5:
+				painter.drawBitmap(x, y, progress_width, progress_height, bits_progress_6);
+				break;
+			case 6:
+				painter.drawBitmap(x, y, progress_width, progress_height, bits_progress_7);
+				break;
+			case 7:
+				painter.drawBitmap(x, y, progress_width, progress_height, bits_progress_8);
+				break;
 		}
 	}
 
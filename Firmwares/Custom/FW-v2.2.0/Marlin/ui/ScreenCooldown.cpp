@@ -34,6 +34,7 @@ namespace ui
 {
 	ScreenCooldown::ScreenCooldown(const char * title, const char * text, uint16_t target, Subject<float> * model)
 		: ScreenAnimation(title, text, LESS_OR_EQUAL, target, model)
+		, m_target_off(false)
 	{
 		this->connect();
 		lcd_enable_button();
@@ -44,91 +45,53 @@ namespace ui
 
 	void ScreenCooldown::draw()
 	{
-		char temp[21] = { 0 };
-		char c_current[4] = { 0 };
-		dtostrf(m_observed, 3, 0, c_current);
-		strcat(temp, c_current);
-		strcat(temp, "\xb0");
-		strcat(temp, " / ");
-
-		if(temp::TemperatureManager::single::instance().getTargetTemperature() >= temp::min_temp_cooling)
+		bool target_off = (temp::TemperatureManager::single::instance().getTargetTemperature() < temp::min_temp_cooling);
+		if (target_off != m_target_off)
 		{
-			char c_target[4] = { 0 };
-			snprintf(c_target, 4, "%d", m_target);
-			strcat(temp, c_target);
-			strcat(temp, "\xb0");
-		}
-		else
-		{
-			strcat_P(temp, MSG_TEMP_OFF());
+			m_target_off = target_off;
+			m_dirty_widgets |= VALUE_WIDGET;
 		}
 
-		//Check time for next progress bar frame
-		m_current_time = millis();
+		ScreenAnimation::draw();
+	}
 
-		if(m_current_time >= m_previous_time + 100)
+	void ScreenCooldown::paint()
+	{
+		painter.title(m_title);
+		painter.box(m_text);
+
+		//Draw temperature
+		if (painter.isVisible(m_value_area))
 		{
-			m_current_time = millis();
-			m_previous_time = m_current_time;
-			m_frame = (m_frame + 1) % 8;
+			char temp[21] = { 0 };
+			char c_current[4] = { 0 };
+			dtostrf(m_observed, 3, 0, c_current);
+			strcat(temp, c_current);
+			strcat(temp, "\xb0");
+			strcat(temp, " / ");
 
-			painter.firstPage();
-			do
+			if(m_target_off == false)
 			{
-				painter.title(m_title);
-				painter.box(m_text);
-
-				//Draw temperature
-				uint8_t y_init = painter.coordinateYInit();
-				uint8_t y_end = painter.coordinateYEnd();
-
-				painter.setColorIndex(1);
-				painter.setPrintPos(64 - strlen(temp)*6/2, (y_end + y_init)/2 - 9/2 - 3);
-				painter.print(temp);
+				char c_target[4] = { 0 };
+				snprintf(c_target, 4, "%d", m_target);
+				strcat(temp, c_target);
+				strcat(temp, "\xb0");
+			}
+			else
+			{
+				strcat_P(temp, MSG_TEMP_OFF());
+			}
 
-				//Draw progress bar
-				painter.setColorIndex(1);
-				painter.drawBox(8,38,112,6);
-				painter.setColorIndex(0);
-				painter.drawBox(9,39,110,4);
-				painter.setColorIndex(1);
+			uint8_t y_init = painter.coordinateYInit();
+			uint8_t y_end = painter.coordinateYEnd();
 
-				switch(m_frame)
-				{
-					case 0:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_1);
-						break;
-					case 1:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_2);
-						break;
-					case 2:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_3);
-						break;
-					case 3:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_4);
-						break;
-					case 4:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_5);
-						break;
-					case 5:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_6);
-						break;
-					case 6:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_7);
-						break;
-					case 7:
-						painter.drawBitmap(10, 40, progress_width, progress_height, bits_progress_8);
-						break;
-				}
-
-			} while ( painter.nextPage() );
+			painter.setColorIndex(1);
+			painter.setPrintPos(64 - strlen(temp)*6/2, (y_end + y_init)/2 - 9/2 - 3);
+			painter.print(temp);
 		}
 
-		if ( isConditionMet() )
-		{
-			lcd_enable_button();
-			ViewManager::getInstance().activeView(m_next_screen);
-		}
+		//Draw progress bar
+		paintProgress(m_progress_area.x_init, m_progress_area.y_init);
 	}
 
 	bool ScreenCooldown::isConditionMet()
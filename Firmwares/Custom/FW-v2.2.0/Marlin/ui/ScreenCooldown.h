@@ -44,7 +44,11 @@ namespace ui
 
 			void draw();
 		private:
+			void paint();
 			bool isConditionMet();
+
+		private:
+			bool m_target_off;
 	};
 }
 
@@ -32,6 +32,7 @@
 #include "Functor.h"
 
 #include "GuiManager.h"
+#include "GuiAction.h"
 
 namespace ui
 {
@@ -49,6 +50,7 @@ namespace ui
 		protected:
 			const char * m_message;
 			const char * m_box;
+			bool m_action_pending;
 	};
 
 	template <typename R, typename... Args>
@@ -57,11 +59,17 @@ namespace ui
 		, Functor<R, Args...>(fptr)
 		, m_message(message)
 		, m_box(box)
+		, m_action_pending(false)
 	{ }
 
 	template <typename R, typename... Args>
 		ScreenDialog<R, Args...>::~ScreenDialog()
-	{ }
+	{
+		if (m_action_pending == true)
+		{
+			lcd_enable_button();
+		}
+	}
 
 	template <typename R, typename... Args>
 		void ScreenDialog<R, Args...>::init(uint16_t index)
@@ -69,6 +77,13 @@ namespace ui
 		lcd_disable_button();
 		draw();
 		this->action();
+
+		if (gui_action_busy() == true)
+		{
+			// The button is enabled from draw() once the action is done
+			m_action_pending = true;
+			return;
+		}
 		lcd_enable_button();
 	}
 
@@ -81,6 +96,12 @@ namespace ui
 	template <typename R, typename... Args>
 		void ScreenDialog<R, Args...>::draw()
 	{
+		if (m_action_pending == true && gui_action_busy() == false)
+		{
+			m_action_pending = false;
+			lcd_enable_button();
+		}
+
 		painter.firstPage();
 		do
 		{
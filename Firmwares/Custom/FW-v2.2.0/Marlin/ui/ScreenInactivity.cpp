@@ -36,6 +36,9 @@ namespace ui
 	ScreenInactivity::ScreenInactivity(const char * title, const char * text, uint16_t target, Subject<float> * model)
 		: ScreenAnimation(title, text, LESS_OR_EQUAL, target, model)
 	{
+		m_value_area = Area(48, 35, 103, 43);
+		m_progress_area = Area(8, 47, 119, 52);
+
 		this->connect();
 		lcd_enable_button();
 	}
@@ -50,107 +53,60 @@ namespace ui
 
 	void ScreenInactivity::draw()
 	{
-		char c_target[4] = { 0 };
-		snprintf(c_target, 4, "%d", m_target);
+		refresh();
+
+		if(!PrintManager::single::instance().getInactivityFlag())
+		{
+			ViewManager::getInstance().activeView(m_next_screen);
+		}
+	}
 
+	void ScreenInactivity::paint()
+	{
+		painter.setColorIndex(1);
+		painter.drawBox(0,0,128,64);
+
+		painter.setColorIndex(0);
+		painter.box(m_text);
+
+		//Paint bitmap logo on the left
+		uint8_t x_init = painter.coordinateXInit();
+		uint8_t y_init = painter.coordinateYInit();
+		uint8_t x_end = painter.coordinateXEnd();
+		uint8_t y_end = painter.coordinateYEnd();
+		uint8_t x_offset = 9;
+		uint8_t y_offset = 9;
+		painter.drawBitmap(x_init + x_offset, y_init + y_offset, logo_width, logo_height, bits_logo_about);
+
+		//Print text
+		x_offset = 8;
+		y_offset = 7;
+		x_init = 128 - strlen_P(MSG_MODE())*6 - x_offset;
+		painter.setPrintPos(x_init, y_offset);
+		painter.print_P(MSG_MODE());
+		x_init = 128 - strlen_P(MSG_INACTIVE())*6 - x_offset;
+		y_init = y_offset + max_font_height + 1;
+		painter.setPrintPos(x_init, y_init + 1);
+		painter.print_P(MSG_INACTIVE());
+
+		//Paint bitmap inactivity on the right
+		x_init = 128 - inactivity_width - x_offset;
+		y_init += 3;
+		painter.drawBitmap(x_init, y_init + y_offset, inactivity_width, inactivity_height, icon_inactivity);
+
+		//Print temp
 		char c_current[4] = { 0 };
 		dtostrf(m_observed, 3, 0, c_current);
 
-		//Check time for next progress bar frame
-		m_current_time = millis();
+		char temp[21] = "";
+		strcat(temp, c_current);
+		strcat(temp, "\xb0");
 
-		if(m_current_time >= m_previous_time)
-		{
-			m_current_time = millis();
-			m_previous_time = m_current_time;
-			m_frame = (m_frame + 1) % 8;
-
-			painter.firstPage();
-			do
-			{
-				painter.setColorIndex(1);
-				painter.drawBox(0,0,128,64);
-
-				painter.setColorIndex(0);
-				painter.box(m_text);
-
-				//Paint bitmap logo on the left
-				uint8_t x_init = painter.coordinateXInit();
-				uint8_t y_init = painter.coordinateYInit();
-				uint8_t x_end = painter.coordinateXEnd();
-				uint8_t y_end = painter.coordinateYEnd();
-				uint8_t x_offset = 9;
-				uint8_t y_offset = 9;
-				painter.drawBitmap(x_init + x_offset, y_init + y_offset, logo_width, logo_height, bits_logo_about);
-
-				//Print text
-				x_offset = 8;
-				y_offset = 7;
-				x_init = 128 - strlen_P(MSG_MODE())*6 - x_offset;
-				painter.setPrintPos(x_init, y_offset);
-				painter.print_P(MSG_MODE());
-				x_init = 128 - strlen_P(MSG_INACTIVE())*6 - x_offset;
-				y_init = y_offset + max_font_height + 1;
-				painter.setPrintPos(x_init, y_init + 1);
-				painter.print_P(MSG_INACTIVE());
-
-				//Paint bitmap inactivity on the right
-				x_init = 128 - inactivity_width - x_offset;
-				y_init += 3;
-				painter.drawBitmap(x_init, y_init + y_offset, inactivity_width, inactivity_height, icon_inactivity);
-
-				//Print temp
-				char temp[21] = "";
-				strcat(temp, c_current);
-				strcat(temp, "\xb0");
-
-				painter.setPrintPos(x_init - strlen(temp)*6 - 4, y_init + (max_font_height + 1)*2 - 5);
-				painter.print(temp);
-
-				//Draw progress bar
-				x_init = 8;
-				y_init = 47;
-				painter.setColorIndex(1);
-				painter.drawBox(x_init, y_init, 112, 6);
-				painter.setColorIndex(0);
-				painter.drawBox(x_init + 1, y_init + 1, 110, 4);
-				painter.setColorIndex(1);
-
-				switch(m_frame)
-				{
-					case 0:
-						painter.drawBitmap(x_init + 2, y_init + 2, progress_width, progress_height, bits_progress_1);
-						break;
-					case 1:
-						painter.drawBitmap(x_init + 2, y_init + 2, progress_width, progress_height, bits_progress_2);
-						break;
-					case 2:
-						painter.drawBitmap(x_init + 2, y_init + 2, progress_width, progress_height, bits_progress_3);
-						break;
-					case 3:
-						painter.drawBitmap(x_init + 2, y_init + 2, progress_width, progress_height, bits_progress_4);
-						break;
-					case 4:
-						painter.drawBitmap(x_init + 2, y_init + 2, progress_width, progress_height, bits_progress_5);
-						break;
-					case 5:
-						painter.drawBitmap(x_init + 2, y_init + 2, progress_width, progress_height, bits_progress_6);
-						break;
-					case 6:
-						painter.drawBitmap(x_init + 2, y_init + 2, progress_width, progress_height, bits_progress_7);
-						break;
-					case 7:
-						painter.drawBitmap(x_init + 2, y_init + 2, progress_width, progress_height, bits_progress_8);
-						break;
-				}
-
-			} while ( painter.nextPage() );
-		}
+		painter.setPrintPos(x_init - strlen(temp)*6 - 4, y_init + (max_font_height + 1)*2 - 5);
+		painter.print(temp);
 
-		if(!PrintManager::single::instance().getInactivityFlag())
-		{
-			ViewManager::getInstance().activeView(m_next_screen);
-		}
+		//Draw progress bar
+		paintProgress(m_progress_area.x_init, m_progress_area.y_init);
 	}
 
 	void ScreenInactivity::press()
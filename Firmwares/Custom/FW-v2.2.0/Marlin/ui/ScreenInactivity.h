@@ -54,6 +54,7 @@ namespace ui
 			void right();
 
 		private:
+			void paint();
 			bool isConditionMet();
 	};
 }
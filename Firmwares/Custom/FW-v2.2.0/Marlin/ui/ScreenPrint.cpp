@@ -35,9 +35,18 @@
 
 namespace ui
 {
+	// Where each widget is drawn, see paint()
+	static const Area title_area(0, 0, screen_width - 1, title_height - 1);
+	static const Area temperature_area(80, 3, screen_width - 1, 11);
+	static const Area status_area(0, 19, 95, 27);
+	static const Area time_area(96, 19, screen_width - 1, 27);
+	static const Area icons_area(0, 31, screen_width - 1, 54);
+	static const Area box_area(0, screen_height - box_height, screen_width - 1, screen_height - 1);
+
 	ScreenPrint::ScreenPrint(const char * title, Subject<float> * model)
 		: ScreenMenu(title)
 		, Observer<float>(model)
+		, m_dirty_widgets(0)
 		, m_observed(0)
 		, m_printed_time( { 0, 0, 0, 0 })
 		, m_previous_minutes(0)
@@ -86,7 +95,7 @@ namespace ui
 				strcat(m_time_info, ":");
 				strcat(m_time_info, painter.itostr2(m_printed_time.minutes));
 
-				m_needs_drawing = true;
+				m_dirty_widgets |= TIME_WIDGET;
 			}
 
 			uint8_t percent_done = card.percentDone();
@@ -94,7 +103,7 @@ namespace ui
 			{
 				m_percent_done = percent_done;
 
-				m_needs_drawing = true;
+				m_dirty_widgets |= STATUS_WIDGET;
 			}
 		}
 
@@ -120,7 +129,7 @@ namespace ui
 					break;
 			}
 
-			m_needs_drawing = true;
+			m_dirty_widgets |= TITLE_WIDGET | STATUS_WIDGET;
 		}
 		
 		if (temp::TemperatureManager::single::instance().getTargetTemperature() != m_target_temperature)
@@ -135,77 +144,133 @@ namespace ui
 			strcat(m_temperature_info, t_target);
 			strcat(m_temperature_info, "\xb0");
 
-			m_needs_drawing = true;
+			m_dirty_widgets |= TEMPERATURE_WIDGET;
 		}
 
 		if (m_needs_drawing == true)
 		{
 			m_needs_drawing = false;
+			m_dirty_widgets = 0;
+#ifdef GUI_DRAW_STATS
+			unsigned long draw_start = micros();
+#endif // GUI_DRAW_STATS
 
 			//Start painting sequence
 			painter.firstPage();
 			do
 			{
-				// Paint title on top of screen
-				painter.title(m_title);
-				painter.setColorIndex(1);
-
-				painter.setPrintPos(127 - (strlen(m_temperature_info) * 6) + 1, 3);
-				painter.print(m_temperature_info);
+				paint();
+			} while( painter.nextPage() );
+#ifdef GUI_DRAW_STATS
+			painter.recordDraw(micros() - draw_start);
+#endif // GUI_DRAW_STATS
+		}
+		else if (m_dirty_widgets != 0)
+		{
+#ifdef GUI_DRAW_STATS
+			unsigned long draw_start = micros();
+#endif // GUI_DRAW_STATS
 
-				if(m_printing_status == PRINTING || m_printing_status == READY)
-				{
-					// Draw status progress bar
-					painter.printingStatus(m_percent_done, true);
-				}
-				else
+			// Repaint only the changed widgets, the rest of the display is
+			// left as it is
+			static const Area * const widget_areas[] = { &title_area, &temperature_area, &status_area, &time_area };
+			for (uint8_t i = 0; i < sizeof(widget_areas) / sizeof(widget_areas[0]); i++)
+			{
+				if (m_dirty_widgets & (1 << i))
 				{
-					//Draw status and Z height
-					painter.printingStatus(m_percent_done, false);
-					painter.setPrintPos( (127 - strlen(m_pause_info) * 6) / 2, 19);
-					painter.print(m_pause_info);
+					painter.firstPage(*widget_areas[i]);
+					do
+					{
+						paint();
+					} while( painter.nextPage() );
 				}
+			}
+			m_dirty_widgets = 0;
+#ifdef GUI_DRAW_STATS
+			painter.recordDraw(micros() - draw_start);
+#endif // GUI_DRAW_STATS
+		}
+	}
 
-				painter.setPrintPos(127 - (strlen(m_time_info) * 6) + 1, 19);
-				painter.print(m_time_info);
+	//! Draws the widgets inside the window of the current frame, all of them
+	//! on a full redraw.
+	void ScreenPrint::paint()
+	{
+		if (painter.isVisible(title_area))
+		{
+			// Paint title on top of screen
+			painter.title(m_title);
+		}
+		painter.setColorIndex(1);
 
-				if ( m_index != (m_num_items -1) && m_index != 0)
-				{
-					painter.box((m_icons[m_index])->text(), BOTH);
-				}
-				else if(m_index == (m_num_items -1))
-				{
-					painter.box((m_icons[m_index])->text(), LEFT);
-				}
-				else if (m_index == 0)
-				{
-					painter.box((m_icons[m_index])->text(), RIGHT);
-				}
+		if (painter.isVisible(temperature_area))
+		{
+			painter.setPrintPos(127 - (strlen(m_temperature_info) * 6) + 1, 3);
+			painter.print(m_temperature_info);
+		}
+
+		if (painter.isVisible(status_area))
+		{
+			if(m_printing_status == PRINTING || m_printing_status == READY)
+			{
+				// Draw status progress bar
+				painter.printingStatus(m_percent_done, true);
+			}
+			else
+			{
+				//Draw status and Z height
+				painter.printingStatus(m_percent_done, false);
+				painter.setPrintPos( (127 - strlen(m_pause_info) * 6) / 2, 19);
+				painter.print(m_pause_info);
+			}
+		}
 
-				// Draw icon grid
-				Area icons_area(0, 31, 127, 54);
-				painter.setWorkingArea(icons_area);
+		if (painter.isVisible(time_area))
+		{
+			painter.setPrintPos(127 - (strlen(m_time_info) * 6) + 1, 19);
+			painter.print(m_time_info);
+		}
 
-				uint8_t x_init = icons_area.x_init;
-				uint8_t y_init = icons_area.y_init;
-				uint8_t x_end = icons_area.x_end;
-				uint8_t y_end = icons_area.y_end;
+		if (painter.isVisible(box_area))
+		{
+			if ( m_index != (m_num_items -1) && m_index != 0)
+			{
+				painter.box((m_icons[m_index])->text(), BOTH);
+			}
+			else if(m_index == (m_num_items -1))
+			{
+				painter.box((m_icons[m_index])->text(), LEFT);
+			}
+			else if (m_index == 0)
+			{
+				painter.box((m_icons[m_index])->text(), RIGHT);
+			}
+		}
 
-				for (uint8_t i = 0; i < m_num_items; i++)
-				{
-					int x = x_init + (icons_area.width() / 2) - ((m_num_items * (icon_width + 2) - 2) / 2) + (i * (icon_width + 2));
-					int y = y_init;
+		if (painter.isVisible(icons_area))
+		{
+			// Draw icon grid
+			painter.setWorkingArea(icons_area);
 
-					if (i == m_index)
-					{
-						m_icons[i]->draw(x,y, true);
-					}
-					else
-					{
-						m_icons[i]->draw(x,y);
-					}
+			uint8_t x_init = icons_area.x_init;
+			uint8_t y_init = icons_area.y_init;
+			uint8_t x_end = icons_area.x_end;
+			uint8_t y_end = icons_area.y_end;
+
+			for (uint8_t i = 0; i < m_num_items; i++)
+			{
+				int x = x_init + (icons_area.width() / 2) - ((m_num_items * (icon_width + 2) - 2) / 2) + (i * (icon_width + 2));
+				int y = y_init;
+
+				if (i == m_index)
+				{
+					m_icons[i]->draw(x,y, true);
 				}
-			} while( painter.nextPage() );
+				else
+				{
+					m_icons[i]->draw(x,y);
+				}
+			}
 		}
 	}
 
@@ -224,7 +289,7 @@ namespace ui
 			strcat(m_temperature_info, t_target);
 			strcat(m_temperature_info, "\xb0");
 
-			m_needs_drawing = true;
+			m_dirty_widgets |= TEMPERATURE_WIDGET;
 		}
 	}
 }
@@ -48,6 +48,19 @@ namespace ui
 			void update(float value);
 
 		private:
+			// Parts of the screen repainted on their own when only they change
+			typedef enum
+			{
+				TITLE_WIDGET       = 0x01,
+				TEMPERATURE_WIDGET = 0x02,
+				STATUS_WIDGET      = 0x04,
+				TIME_WIDGET        = 0x08,
+			} Widget_t;
+
+			void paint();
+
+		private:
+			uint8_t m_dirty_widgets;
 			float m_observed;
 			Time_t m_printed_time;
 			uint8_t m_previous_minutes;
@@ -48,10 +48,11 @@ namespace ui
 			void add(Option * view);
 			void init(uint16_t index = 0);
 
+			static const uint16_t m_max_items = 11;
+
 		private:
 			uint16_t m_index;
 
-			static const uint16_t m_max_items = 11;
 			Option * m_item[m_max_items];
 			uint8_t m_num_items;
 
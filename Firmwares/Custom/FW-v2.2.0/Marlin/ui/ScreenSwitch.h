@@ -37,7 +37,7 @@ namespace ui
 	class ScreenSwitch : public ScreenAction<bool>
 	{
 		public:
-			ScreenSwitch(const char * title = 0, Functor<bool>::FuncPtr fptr = false);
+			ScreenSwitch(const char * title = 0, Functor<bool>::FuncPtr fptr = 0);
 			virtual ~ScreenSwitch();
 
 			void init(uint16_t index = 0);
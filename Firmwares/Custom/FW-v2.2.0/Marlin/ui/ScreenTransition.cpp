@@ -28,6 +28,7 @@
 #include "ScreenTransition.h"
 
 #include "GuiManager.h"
+#include "GuiAction.h"
 #include "Language.h"
 
 namespace ui
@@ -38,6 +39,7 @@ namespace ui
 		, Observer<PrinterState_t>(model)
 		, m_box(box)
 		, m_printing_status(PRINTING)
+		, m_action_pending(false)
 	{
 		memset(m_message, 0, sizeof(m_message));
 
@@ -48,7 +50,12 @@ namespace ui
 	}
 
 	ScreenTransition::~ScreenTransition()
-	{ }
+	{
+		if (m_action_pending == true)
+		{
+			lcd_enable_button();
+		}
+	}
 
 	void ScreenTransition::init(uint16_t index)
 	{
@@ -58,6 +65,12 @@ namespace ui
 
 		if (this->m_model == 0)
 		{
+			if (gui_action_busy() == true)
+			{
+				// Moves on from draw() once the action is done
+				m_action_pending = true;
+				return;
+			}
 			lcd_enable_button();
 			ViewManager::getInstance().activeView(m_next_screen);
 		}
@@ -65,6 +78,14 @@ namespace ui
 
 	void ScreenTransition::draw()
 	{
+		if (m_action_pending == true && gui_action_busy() == false)
+		{
+			m_action_pending = false;
+			lcd_enable_button();
+			ViewManager::getInstance().activeView(m_next_screen);
+			return;
+		}
+
 		painter.firstPage();
 		do
 		{
@@ -48,6 +48,7 @@ namespace ui
 			char m_message[64];
 			const char * m_box;
 			PrinterState_t m_printing_status;
+			bool m_action_pending;
 	};
 }
 #endif //SCREEN_TRANSITION_H
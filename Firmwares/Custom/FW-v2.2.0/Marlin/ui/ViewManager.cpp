@@ -26,6 +26,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "ViewManager.h"
+#include "ViewPool.h"
 
 namespace ui
 {
@@ -35,36 +36,115 @@ namespace ui
 		return instance;
 	}
 
+	//! Asks for the view at index. The view that asks for it from one of its
+	//! handlers still runs in the arena the new view would be built in, so
+	//! the switch waits until the outermost handler has returned. Asked for
+	//! from anywhere else, the view is built at once.
 	void ViewManager::activeView(ScreenIndex_t const & index)
 	{
-		// Check if last view requires to keep element focus
-		bool keep_focus = false;
-		if (m_active_view->type() == Screen::ACTION)
+		// index may belong to the last view, copy it before deleting it
+		m_pending_index = index;
+		m_switch_pending = true;
+
+		if (m_handler_depth == 0)
 		{
-			keep_focus = true;
+			switchView();
 		}
+	}
+
+	void ViewManager::switchView()
+	{
+		while (m_switch_pending == true)
+		{
+			m_switch_pending = false;
+
+			// Check if last view requires to keep element focus
+			bool keep_focus = false;
+			if ( (m_active_view != NULL) && (m_active_view->type() == Screen::ACTION) )
+			{
+				keep_focus = true;
+			}
+
+			m_index = m_pending_index;
+
+			// Delete last view, its memory goes to the new one
+			delete m_active_view;
+			ViewPool::clear();
+
+			// Build new active view
+			m_active_view = GuiBuild(m_index);
+			m_refresh_pending = true;
+
+			// init() may ask for yet another view, built on the next turn
+			m_handler_depth++;
 
-		// Delete last view
-		delete m_active_view;
-		m_index = index;
+			// Keep focus if required
+			if ( (keep_focus) && (m_active_view->type() == Screen::MENU) )
+			{
+				m_active_view->init(m_last_focus);
+			}
+			else
+			{
+				m_active_view->init();
+			}
 
-		// Build new active view
-		m_active_view = GuiBuild(index);
+			m_handler_depth--;
+		}
+	}
+
+	Screen * ViewManager::activeView()
+	{
+		return m_active_view;
+	}
+
+	//! Handlers of the active view. The display may be updated again while
+	//! one of them waits for the printer, so they nest.
+	void ViewManager::left()
+	{
+		m_handler_depth++;
+		m_active_view->left();
+		m_handler_depth--;
 
-		// Keep focus if required
-		if ( (keep_focus) && (m_active_view->type() == Screen::MENU) )
+		if (m_handler_depth == 0)
 		{
-			m_active_view->init(m_last_focus);
+			switchView();
 		}
-		else
+	}
+
+	void ViewManager::right()
+	{
+		m_handler_depth++;
+		m_active_view->right();
+		m_handler_depth--;
+
+		if (m_handler_depth == 0)
 		{
-			m_active_view->init();
+			switchView();
 		}
 	}
 
-	Screen * ViewManager::activeView()
+	void ViewManager::press()
 	{
-		return m_active_view;
+		m_handler_depth++;
+		m_active_view->press();
+		m_handler_depth--;
+
+		if (m_handler_depth == 0)
+		{
+			switchView();
+		}
+	}
+
+	void ViewManager::draw()
+	{
+		m_handler_depth++;
+		m_active_view->draw();
+		m_handler_depth--;
+
+		if (m_handler_depth == 0)
+		{
+			switchView();
+		}
 	}
 
 	void ViewManager::setLastFocus(uint16_t last_focus)
@@ -80,11 +160,25 @@ namespace ui
 	void ViewManager::displayRefresh()
 	{
 		m_active_view->m_needs_drawing = true;
+		m_refresh_pending = true;
+	}
+
+	//! True once after a view is activated or asked to be redrawn, so the
+	//! display is refreshed without waiting for its next turn.
+	bool ViewManager::refreshPending()
+	{
+		bool pending = m_refresh_pending;
+		m_refresh_pending = false;
+		return pending;
 	}
 
 	ViewManager::ViewManager()
 		: m_active_view(NULL)
 		  , m_last_focus(0)
+		  , m_refresh_pending(false)
+		  , m_pending_index(screen_none)
+		  , m_switch_pending(false)
+		  , m_handler_depth(0)
 	{ }
 
 	ViewManager::~ViewManager()
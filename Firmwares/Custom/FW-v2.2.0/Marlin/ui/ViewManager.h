@@ -42,10 +42,17 @@ namespace ui
 
 			void activeView(ScreenIndex_t const & index);
 			Screen * activeView();
+
+			void left();
+			void right();
+			void press();
+			void draw();
+
 			void setLastFocus(uint16_t last_focus);
 			ScreenIndex_t const & getViewIndex() const;
 
 			void displayRefresh();
+			bool refreshPending();
 
 		protected:
 			ViewManager();
@@ -55,10 +62,18 @@ namespace ui
 			ViewManager(ViewManager const & orig) = delete;
 			ViewManager & operator=(ViewManager & orig) = delete;
 
+		private:
+			void switchView();
+
 		private:
 			Screen * m_active_view;
 			uint16_t m_last_focus;
 			ScreenIndex_t m_index;
+			bool m_refresh_pending;
+
+			ScreenIndex_t m_pending_index;
+			bool m_switch_pending;
+			uint8_t m_handler_depth;
 	};
 }
 #endif //VIEW_MANAGER_H
@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file ViewPool.cpp
+///
+/// \brief Static memory for the screen on display and its icons.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or 
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL 
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ViewPool.h"
+
+#include <stdlib.h>
+
+namespace ui
+{
+	uint16_t ViewPool::s_used = 0;
+
+	void * ViewPool::allocate(size_t size)
+	{
+		// Keep every object aligned as the heap would
+		size = (size + __alignof__(void *) - 1) & ~(__alignof__(void *) - 1);
+
+		if (size > s_size - s_used)
+		{
+			return malloc(size);
+		}
+
+		void * pointer = s_pool + s_used;
+		s_used += size;
+		return pointer;
+	}
+
+	//! Objects in the arena are freed all together by clear().
+	void ViewPool::release(void * pointer)
+	{
+		if ( ((uint8_t *) pointer < s_pool) || ((uint8_t *) pointer >= s_pool + s_size) )
+		{
+			free(pointer);
+		}
+	}
+
+	//! Called once the last view is destroyed, before the next one is built.
+	void ViewPool::clear()
+	{
+		s_used = 0;
+	}
+
+	//! Bytes of the arena taken by the view on display.
+	uint16_t ViewPool::used()
+	{
+		return s_used;
+	}
+
+	uint16_t ViewPool::size()
+	{
+		return s_size;
+	}
+}
@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file ViewPool.h
+///
+/// \brief Static memory for the screen on display and its icons.
+///
+/// Copyright (c) 2015 BQ - Mundo Reader S.L.
+/// http://www.bq.com
+///
+/// This file is free software; you can redistribute it and/or modify
+/// it under the terms of either the GNU General Public License version 2 or 
+/// later or the GNU Lesser General Public License version 2.1 or later, both
+/// as published by the Free Software Foundation.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL 
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VIEW_POOL_H
+#define VIEW_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ui
+{
+	//! \brief Arena the active view is built in.
+	//!
+	//! GuiBuild() makes a view all at once (the screen and its icons or
+	//! options) and ViewManager destroys it all at once when the next one
+	//! replaces it. So Screen, Icon and Option take their memory one object
+	//! after the other from a static arena, emptied on every view change,
+	//! instead of the heap. A menu step costs no malloc() and leaves no holes.
+	//!
+	//! The arena is defined in GuiImpl_witbox_2.cpp, sized at compile time
+	//! for the largest screen type with as many of the largest icon or
+	//! option type as a screen holds. A view that still does not fit takes
+	//! the rest of its objects from the heap.
+	class ViewPool
+	{
+		public:
+			static void * allocate(size_t size);
+			static void release(void * pointer);
+			static void clear();
+
+			static uint16_t used();
+			static uint16_t size();
+
+			template <typename... Types> struct Largest;
+
+		private:
+			static uint8_t s_pool[];
+			static const uint16_t s_size;
+			static uint16_t s_used;
+	};
+
+	//! Size of the largest of the given types.
+	template <typename Type>
+		struct ViewPool::Largest<Type>
+	{
+		static const size_t size = sizeof(Type);
+	};
+
+	template <typename Type, typename... Types>
+		struct ViewPool::Largest<Type, Types...>
+	{
+		static const size_t size = (sizeof(Type) > Largest<Types...>::size) ? sizeof(Type) : Largest<Types...>::size;
+	};
+}
+#endif //VIEW_POOL_H
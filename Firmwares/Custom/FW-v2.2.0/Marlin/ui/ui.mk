@@ -24,5 +24,6 @@ CXXSRC += \
 	ScreenTransition.cpp \
 	ScreenStats.cpp \
 	ScreenError.cpp \
-	ViewManager.cpp
+	ViewManager.cpp \
+	ViewPool.cpp
 	
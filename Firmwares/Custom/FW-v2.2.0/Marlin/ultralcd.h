@@ -40,7 +40,7 @@ extern int absPreheatHotendTemp;
 extern int absPreheatHPBTemp;
 extern int absPreheatFanSpeed;
 
-extern bool cancel_heatup;
+extern volatile bool cancel_heatup;
 // END TODO
 
 //
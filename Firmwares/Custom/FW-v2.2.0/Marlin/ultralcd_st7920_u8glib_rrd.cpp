@@ -1,11 +1,59 @@
 #include "ultralcd_st7920_u8glib_rrd.h"
 
+#ifdef ST7920_DIRTY_ROWS
+  #include <util/crc16.h>
+#endif
+#ifdef HOST_BUILD
+  #include "Host.h"
+#endif
+
 uint8_t  u8g_dev_st7920_128x64_rrd_buf[LCD_PIXEL_WIDTH*(PAGE_HEIGHT/8)] U8G_NOCOMMON;
 u8g_pb_t  u8g_dev_st7920_128x64_rrd_pb = {{PAGE_HEIGHT,LCD_PIXEL_HEIGHT,0,0,0},LCD_PIXEL_WIDTH,u8g_dev_st7920_128x64_rrd_buf};
 u8g_dev_t u8g_dev_st7920_128x64_rrd_sw_spi = {u8g_dev_rrd_st7920_128x64_fn,&u8g_dev_st7920_128x64_rrd_pb,&u8g_com_null_fn};
 
+uint16_t u8g_dev_st7920_128x64_rrd_frame_bytes = 0;
+uint32_t u8g_dev_st7920_128x64_rrd_total_bytes = 0;
+static uint16_t st7920_bytes = 0;
+
+#ifdef ST7920_DIRTY_ROWS
+// CRC of each row as it was last sent. A row is only sent again when its
+// CRC changes, so a frame that differs from the last one by a few digits
+// costs a few rows instead of the whole display.
+static uint16_t st7920_row_crc[LCD_PIXEL_HEIGHT];
+
+// One row is sent every frame whether it changed or not, a different one
+// each time, so a change the CRC missed or pixels garbled on the cable are
+// repaired within LCD_PIXEL_HEIGHT frames.
+static uint8_t st7920_refresh_row = 0;
+
+// Rows last written by a window narrower than the screen. Their CRC no
+// longer matches what the display shows, so they are sent on the next
+// frame that covers them whole.
+static uint8_t st7920_row_stale[LCD_PIXEL_HEIGHT/8];
+#endif
+
+// Part of the screen drawn and sent by the next frames, x in 16 pixel
+// words of the GDRAM. The whole screen unless a window is set.
+static uint8_t st7920_window_x0 = 0;
+static uint8_t st7920_window_x1 = LCD_PIXEL_WIDTH/16 - 1;
+static uint8_t st7920_window_y0 = 0;
+static uint8_t st7920_window_y1 = LCD_PIXEL_HEIGHT - 1;
+
+void u8g_dev_st7920_128x64_rrd_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+  st7920_window_x0 = x0 / 16;
+  st7920_window_x1 = x1 / 16;
+  st7920_window_y0 = y0;
+  st7920_window_y1 = y1;
+}
+
 void ST7920_SWSPI_SND_8BIT(uint8_t val)
 {
+  st7920_bytes++;
+#ifdef HOST_BUILD
+  //the emulated display takes the byte whole
+  host_display_receive(val);
+#else
   uint8_t i;
   for( i=0; i<8; i++ )
   {
@@ -20,9 +68,34 @@ void ST7920_SWSPI_SND_8BIT(uint8_t val)
       __asm__("nop\n\t""nop\n\t"); 
     #endif
   }
+#endif // HOST_BUILD
 }
 
 
+static uint8_t st7920_pb_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
+{
+#if PAGE_HEIGHT == 64
+  //pb32h1 draws into a page of any height but only clears 32 rows of it
+  if(msg == U8G_DEV_MSG_PAGE_FIRST || msg == U8G_DEV_MSG_PAGE_NEXT)
+  {
+    u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+    if(msg == U8G_DEV_MSG_PAGE_FIRST)
+      u8g_page_First(&(pb->p));
+    else if(u8g_page_Next(&(pb->p)) == 0)
+      return 0;
+    memset(pb->buf, 0, sizeof(u8g_dev_st7920_128x64_rrd_buf));
+    return 1;
+  }
+  return u8g_dev_pb32h1_base_fn(u8g, dev, msg, arg);
+#elif PAGE_HEIGHT == 8
+  return u8g_dev_pb8h1_base_fn(u8g, dev, msg, arg);
+#elif PAGE_HEIGHT == 16
+  return u8g_dev_pb16h1_base_fn(u8g, dev, msg, arg);
+#else
+  return u8g_dev_pb32h1_base_fn(u8g, dev, msg, arg);
+#endif
+}
+
 uint8_t u8g_dev_rrd_st7920_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
 {
   uint8_t i,y;
@@ -52,9 +125,39 @@ uint8_t u8g_dev_rrd_st7920_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
         }
         ST7920_WRITE_BYTE(0x0C); //display on, cursor+blink off
         ST7920_NCS();
+        #ifdef ST7920_DIRTY_ROWS
+          memset(st7920_row_crc, 0, sizeof(st7920_row_crc)); //CRC of a blank row is 0
+          memset(st7920_row_stale, 0, sizeof(st7920_row_stale));
+        #endif
       }
       break;
 
+    case U8G_DEV_MSG_PAGE_FIRST:
+      {
+        u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+        st7920_bytes = 0;
+        st7920_pb_fn(u8g, dev, msg, arg);
+        //pages above the window are neither drawn nor sent
+        while(pb->p.page_y1 < st7920_window_y0)
+          u8g_page_Next(&(pb->p));
+      }
+      return 1;
+
+    case U8G_DEV_MSG_GET_PAGE_BOX:
+      {
+        //U8glib skips whatever falls outside of the box
+        u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+        u8g_box_t *box = (u8g_box_t *)arg;
+        u8g_pb_GetPageBox(pb, box);
+        box->x0 = st7920_window_x0 * 16;
+        box->x1 = st7920_window_x1 * 16 + 15;
+        if(box->y0 < st7920_window_y0)
+          box->y0 = st7920_window_y0;
+        if(box->y1 > st7920_window_y1)
+          box->y1 = st7920_window_y1;
+      }
+      return 1;
+
     case U8G_DEV_MSG_STOP:
       break;
     case U8G_DEV_MSG_PAGE_NEXT:
@@ -64,34 +167,70 @@ uint8_t u8g_dev_rrd_st7920_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
         y = pb->p.page_y0;
         ptr = (uint8_t*)pb->buf;
 
-        ST7920_CS();
-        for( i = 0; i < PAGE_HEIGHT; i ++ )
+        #ifdef ST7920_DIRTY_ROWS
+          bool whole_rows = st7920_window_x0 == 0 && st7920_window_x1 == LCD_PIXEL_WIDTH/16 - 1;
+        #endif
+        uint8_t x0 = st7920_window_x0;
+        uint8_t words = st7920_window_x1 - st7920_window_x0 + 1;
+        bool selected = false;
+        for( i = 0; i < PAGE_HEIGHT; i ++, y++, ptr += LCD_PIXEL_WIDTH/8 )
         {
+          if(y < st7920_window_y0 || y > st7920_window_y1)
+            continue;
+          #ifdef ST7920_DIRTY_ROWS
+            uint8_t stale_mask = 1 << (y & 7);
+            if(whole_rows)
+            {
+              uint16_t crc = 0;
+              for(uint8_t j = 0; j < LCD_PIXEL_WIDTH/8; j++)
+                crc = _crc_xmodem_update(crc, ptr[j]);
+              if(crc == st7920_row_crc[y] && y != st7920_refresh_row && !(st7920_row_stale[y/8] & stale_mask))
+                continue;
+              st7920_row_crc[y] = crc;
+              st7920_row_stale[y/8] &= ~stale_mask;
+            }
+            else
+            {
+              st7920_row_stale[y/8] |= stale_mask;
+            }
+          #endif
+          if(!selected)
+          {
+            ST7920_CS();
+            selected = true;
+          }
           ST7920_SET_CMD();
           if ( y < 32 )
           {
             ST7920_WRITE_BYTE(0x80 | y);       //y
-            ST7920_WRITE_BYTE(0x80);           //x=0
+            ST7920_WRITE_BYTE(0x80 | x0);      //x
           }
           else
           {
             ST7920_WRITE_BYTE(0x80 | (y-32));  //y
-            ST7920_WRITE_BYTE(0x80 | 8);       //x=64
+            ST7920_WRITE_BYTE(0x80 | (8 + x0));//x, lower half of the screen
           }
 
           ST7920_SET_DAT();
-          ST7920_WRITE_BYTES(ptr,LCD_PIXEL_WIDTH/8); //ptr is incremented inside of macro
-          y++;
+          uint8_t *row = ptr + 2*x0;
+          ST7920_WRITE_BYTES(row,2*words); //row is incremented inside of macro
+        }
+        if(selected)
+          ST7920_NCS();
+
+        if(pb->p.page_y1 >= st7920_window_y1)
+        {
+          //last page of the frame, the ones below the window are skipped
+          u8g_dev_st7920_128x64_rrd_frame_bytes = st7920_bytes;
+          u8g_dev_st7920_128x64_rrd_total_bytes += st7920_bytes;
+          #ifdef ST7920_DIRTY_ROWS
+            if(whole_rows)
+              st7920_refresh_row = (st7920_refresh_row + 1) % LCD_PIXEL_HEIGHT;
+          #endif
+          return 0;
         }
-        ST7920_NCS();
       }
       break;
   }
-#if PAGE_HEIGHT == 8
-  return u8g_dev_pb8h1_base_fn(u8g, dev, msg, arg);
-#elif PAGE_HEIGHT == 16
-  return u8g_dev_pb16h1_base_fn(u8g, dev, msg, arg);
-#else
-  return u8g_dev_pb32h1_base_fn(u8g, dev, msg, arg);
-#endif
+  return st7920_pb_fn(u8g, dev, msg, arg);
 }
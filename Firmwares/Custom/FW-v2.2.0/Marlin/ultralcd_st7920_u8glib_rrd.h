@@ -14,7 +14,11 @@
 
 //#define PAGE_HEIGHT 8   //128 byte framebuffer
 //#define PAGE_HEIGHT 16  //256 byte framebuffer
-#define PAGE_HEIGHT 32  //512 byte framebuffer
+#ifdef ST7920_FULL_FRAMEBUFFER
+  #define PAGE_HEIGHT 64  //1024 byte framebuffer, the whole screen in one page
+#else
+  #define PAGE_HEIGHT 32  //512 byte framebuffer
+#endif
 
 #define LCD_PIXEL_WIDTH 128
 #define LCD_PIXEL_HEIGHT 64
@@ -32,6 +36,16 @@ extern void ST7920_SWSPI_SND_8BIT(uint8_t val);
 
 extern uint8_t u8g_dev_rrd_st7920_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
+// Bytes sent over the soft-SPI for the last complete frame, and for all
+// the frames since start up
+extern uint16_t u8g_dev_st7920_128x64_rrd_frame_bytes;
+extern uint32_t u8g_dev_st7920_128x64_rrd_total_bytes;
+
+// Limits the next frames to a window of the screen, x widened to 16 pixel
+// words. Drawing outside of it is skipped and the rest of the display is
+// left as it is.
+extern void u8g_dev_st7920_128x64_rrd_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+
 extern uint8_t u8g_dev_st7920_128x64_rrd_buf[LCD_PIXEL_WIDTH*(PAGE_HEIGHT/8)];
 extern u8g_pb_t  u8g_dev_st7920_128x64_rrd_pb;
 extern u8g_dev_t u8g_dev_st7920_128x64_rrd_sw_spi;